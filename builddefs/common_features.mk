@@ -26,6 +26,7 @@ QUANTUM_SRC += \
     $(QUANTUM_DIR)/keymap_common.c \
     $(QUANTUM_DIR)/keycode_config.c \
     $(QUANTUM_DIR)/sync_timer.c \
+    $(QUANTUM_DIR)/timeout.c \
     $(QUANTUM_DIR)/logging/debug.c \
     $(QUANTUM_DIR)/logging/sendchar.c \
 
@@ -658,6 +659,7 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     ifneq ($(strip $(CUSTOM_MATRIX)), lite)
         # Include the standard or split matrix code if needed
         QUANTUM_SRC += $(QUANTUM_DIR)/matrix.c
+        QUANTUM_SRC += $(QUANTUM_DIR)/matrix_port.c
     endif
 endif
 
@@ -815,6 +817,9 @@ ifeq ($(strip $(SEND_STRING_ENABLE)), yes)
     OPT_DEFS += -DSEND_STRING_ENABLE
     COMMON_VPATH += $(QUANTUM_DIR)/send_string
     SRC += $(QUANTUM_DIR)/send_string/send_string.c
+    ifeq ($(strip $(SEND_STRING_ASYNC_ENABLE)), yes)
+        OPT_DEFS += -DSEND_STRING_ASYNC_ENABLE
+    endif
 endif
 
 ifeq ($(strip $(AUTO_SHIFT_ENABLE)), yes)
@@ -37,6 +37,8 @@ GENERIC_FEATURES = \
     SPACE_CADET \
     SWAP_HANDS \
     TAP_DANCE \
+    TASK_PROFILER \
+    TASK_SCHEDULER \
     VELOCIKEY \
     WPM \
     DYNAMIC_TAPPING_TERM \
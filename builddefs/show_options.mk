@@ -86,7 +86,10 @@ OTHER_OPTION_NAMES = \
   CAPS_WORD_ENABLE \
   AUTOCORRECT_ENABLE \
   TRI_LAYER_ENABLE \
-  REPEAT_KEY_ENABLE
+  REPEAT_KEY_ENABLE \
+  TASK_PROFILER_ENABLE \
+  TASK_SCHEDULER_ENABLE \
+  SEND_STRING_ASYNC_ENABLE
 
 define NAME_ECHO
        @printf "  %-30s = %-16s # %s\\n" "$1" "$($1)" "$(origin $1)"
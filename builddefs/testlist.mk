@@ -3,6 +3,7 @@ FULL_TESTS := $(notdir $(TEST_LIST))
 
 include $(QUANTUM_PATH)/debounce/tests/testlist.mk
 include $(QUANTUM_PATH)/encoder/tests/testlist.mk
+include $(QUANTUM_PATH)/matrix_port/tests/testlist.mk
 include $(QUANTUM_PATH)/os_detection/tests/testlist.mk
 include $(QUANTUM_PATH)/sequencer/tests/testlist.mk
 include $(QUANTUM_PATH)/wear_leveling/tests/testlist.mk
@@ -19,4 +20,4 @@ define VALIDATE_TEST_LIST
 endef
 
 
-$(eval $(call VALIDATE_TEST_LIST,$(firstword $(TEST_LIST)),$(wordlist 2,9999,$(TEST_LIST))))
+$(eval $(call VALIDATE_TEST_LIST,$(firstword $(TEST_LIST) $(BENCHMARK_LIST)),$(wordlist 2,9999,$(TEST_LIST) $(BENCHMARK_LIST))))
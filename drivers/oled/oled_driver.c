@@ -23,6 +23,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "oled_driver.h"
 #include OLED_FONT_H
 #include "timer.h"
+#include "task_scheduler.h"
 #include "print.h"
 #include <string.h>
 #include "progmem.h"
@@ -461,6 +462,11 @@ void oled_render(void) {
     uint8_t update_start  = 0;
     uint8_t num_processed = 0;
     while (oled_dirty && num_processed++ < OLED_UPDATE_PROCESS_LIMIT) { // render all dirty blocks (up to the configured limit)
+        // Leave the remaining dirty blocks for the next run if the matrix needs servicing
+        if (num_processed > 1 && task_scheduler_should_yield()) {
+            break;
+        }
+
         // Find next dirty block
         while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
             ++update_start;
@@ -970,6 +976,19 @@ void oled_task(void) {
 #endif
 }
 
+uint32_t oled_task_interval(void) {
+    // Keep rendering dirty blocks as fast as possible, otherwise wait for the next update
+    if (!oled_initialized || (oled_dirty && !oled_scrolling)) {
+        return 0;
+    }
+#if OLED_UPDATE_INTERVAL > 0
+    uint16_t elapsed = timer_elapsed(oled_update_timeout);
+    return elapsed >= OLED_UPDATE_INTERVAL ? 0 : OLED_UPDATE_INTERVAL - elapsed;
+#else
+    return TASK_SCHEDULER_DEFAULT_INTERVAL;
+#endif
+}
+
 __attribute__((weak)) bool oled_task_kb(void) {
     return oled_task_user();
 }
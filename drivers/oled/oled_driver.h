@@ -442,6 +442,9 @@ uint8_t oled_get_brightness(void);
 // Basically it's oled_render, but with timeout management and oled_task_user calling!
 void oled_task(void);
 
+// Milliseconds until oled_task() next has work to do
+uint32_t oled_task_interval(void);
+
 // Called at the start of oled_task, weak function overridable by the user
 bool oled_task_kb(void);
 bool oled_task_user(void);
@@ -24,11 +24,15 @@ Example:
   lenght        -> length
   ouput         -> output
   widht         -> width
+Pass `--format double-array` to serialize the trie as a double array instead,
+which the firmware walks with a single lookup per typed key, and which has no
+64KB size limit.
 For full documentation, see QMK Docs
 """
 
 import sys
 import textwrap
+from collections import deque
 from typing import Any, Dict, Iterator, List, Tuple
 
 from milc import cli
@@ -49,6 +53,12 @@ TYPO_CHARS = dict([
 ] + [(chr(c), c + KC_A - ord('a')) for c in range(ord('a'),
                                                   ord('z') + 1)])  # Characters a-z.
 
+# Labels of the double-array trie edges, which must match autocorrect_symbol() in process_autocorrect.c.
+TYPO_SYMBOLS = dict([(chr(c), c - ord('a') + 1) for c in range(ord('a'), ord('z') + 1)] + [
+    ("'", 27),
+    (':', 28),
+])
+
 
 def parse_file(file_name: str) -> List[Tuple[str, str]]:
     """Parses autocorrections dictionary file.
@@ -80,6 +90,7 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
 
     autocorrections = []
     typos = set()
+    substrings = {}  # Every substring of the typos so far, and the typo it came from.
     for line_number, typo, correction in parse_file_lines(file_name):
         if typo in typos:
             cli.log.warning('{fg_red}Error:%d:{fg_reset} Ignoring duplicate typo: "{fg_cyan}%s{fg_reset}"', line_number, typo)
@@ -89,10 +100,11 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
         if not (all([c in TYPO_CHARS for c in typo])):
             cli.log.error('{fg_red}Error:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" has characters other than a-z, \' and :.', line_number, typo)
             sys.exit(1)
-        for other_typo in typos:
-            if typo in other_typo or other_typo in typo:
-                cli.log.error('{fg_red}Error:%d:{fg_reset} Typos may not be substrings of one another, otherwise the longer typo would never trigger: "{fg_cyan}%s{fg_reset}" vs. "{fg_cyan}%s{fg_reset}".', line_number, typo, other_typo)
-                sys.exit(1)
+        typo_substrings = {typo[i:j] for i in range(len(typo)) for j in range(i + 1, len(typo) + 1)}
+        other_typo = substrings.get(typo) or next((substring for substring in typo_substrings if substring in typos), None)
+        if other_typo:
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Typos may not be substrings of one another, otherwise the longer typo would never trigger: "{fg_cyan}%s{fg_reset}" vs. "{fg_cyan}%s{fg_reset}".', line_number, typo, other_typo)
+            sys.exit(1)
         if len(typo) < 5:
             cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} It is suggested that typos are at least 5 characters long to avoid false triggers: "{fg_cyan}%s{fg_reset}"', line_number, typo)
         if len(typo) > 127:
@@ -103,6 +115,7 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
 
         autocorrections.append((typo, correction))
         typos.add(typo)
+        substrings.update(dict.fromkeys(typo_substrings, typo))
 
     return autocorrections
 
@@ -178,17 +191,7 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     # Traverse trie in depth first order.
     def traverse(trie_node):
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
+            data = serialize_correction(*trie_node['LEAF'])
 
             entry = {'data': data, 'links': [], 'byte_offset': 0}
             table.append(entry)
@@ -232,11 +235,114 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
+def serialize_correction(typo: str, correction: str) -> List[int]:
+    """Serializes the backspaces and text that turn `typo` into `correction`.
+  Args:
+    typo: String, the typo as written in the dictionary.
+    correction: String, its correction.
+  Returns:
+    List of ints in the range 0-255: the backspace count ORed with 128,
+    followed by the null-terminated replacement text.
+  """
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    return [backspaces + 128] + list(bytes(correction[i:], 'ascii')) + [0]
+
+
+def serialize_double_array(trie: Dict[str, Any]) -> Tuple[List[int], List[int], List[int], int]:
+    """Serializes the trie as a double array, so that following an edge is a single lookup.
+  The child of state `s` for label `c` is state `base[s] + c`, which exists if
+  `check[base[s] + c] == c`. Every branching state gets a distinct base, so the
+  label alone identifies the parent. Leaf states store the offset of their entry
+  in `corrections`, ORed with the leaf flag. Most of a trie is single-child
+  chains leading to a leaf, so such a chain ends at its first state and the
+  rest of its labels, the tail, is stored in the entry: the length of the
+  tail, the tail labels and then the serialized correction.
+  Args:
+    trie: Dict of dicts.
+  Returns:
+    Tuple of the base array, the check array, the corrections and the leaf flag.
+  """
+    base = [0]
+    check = [0]
+    leaves = {}
+    corrections = []
+    offsets = {}
+    used_bases = set()
+    next_free = [1]  # Points towards the next free cell, with cells past the end free.
+
+    def find_free(cell):
+        root = cell
+        while root < len(next_free) and next_free[root] != root:
+            root = next_free[root]
+        while cell < len(next_free) and next_free[cell] != cell:
+            next_free[cell], cell = root, next_free[cell]
+        return root
+
+    def chain_tail(node):
+        tail = []
+        while 'LEAF' not in node:
+            if len(node) != 1:
+                return None
+            c, node = next(iter(node.items()))
+            tail.append(TYPO_SYMBOLS[c])
+        return tail, node['LEAF']
+
+    queue = deque([(trie, 0)])
+    while queue:
+        node, state = queue.popleft()
+
+        chain = chain_tail(node) if state else None
+        if chain:  # Identical entries are stored once.
+            tail, (typo, correction) = chain
+            data = tuple([len(tail)] + tail + serialize_correction(typo, correction))
+            if data not in offsets:
+                offsets[data] = len(corrections)
+                corrections.extend(data)
+            leaves[state] = offsets[data]
+            continue
+
+        children = sorted((TYPO_SYMBOLS[c], child) for c, child in node.items())
+        symbols = [symbol for symbol, _ in children]
+
+        # First fit: try the free cells in order for the first child.
+        cell = find_free(symbols[0])
+        while True:
+            b = cell - symbols[0]
+            if b not in used_bases and all(b + symbol >= len(check) or not check[b + symbol] for symbol in symbols):
+                break
+            cell = find_free(cell + 1)
+        used_bases.add(b)
+
+        if b + symbols[-1] >= len(check):
+            grow = b + symbols[-1] + 1 - len(check)
+            base.extend([0] * grow)
+            check.extend([0] * grow)
+            next_free.extend(range(len(next_free), len(check)))
+
+        base[state] = b
+        for symbol, child in children:
+            check[b + symbol] = symbol
+            next_free[b + symbol] = b + symbol + 1
+            queue.append((child, b + symbol))
+
+    leaf = 0x8000 if max(len(base), len(corrections)) < 0x8000 else 0x80000000
+    for state, offset in leaves.items():
+        base[state] = leaf | offset
+
+    return base, check, corrections, leaf
+
+
 def encode_link(link: Dict[str, Any]) -> List[int]:
     """Encodes a node link as two bytes."""
     byte_offset = link['byte_offset']
     if not (0 <= byte_offset <= 0xffff):
-        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries.')
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries, or use --format double-array.')
         sys.exit(1)
     return [byte_offset & 255, byte_offset >> 8]
 
@@ -249,16 +355,25 @@ def to_hex(b: int) -> str:
     return f'0x{b:02X}'
 
 
+def c_array(name: str, c_type: str, size: str, data: List[int], fmt=to_hex) -> List[str]:
+    """Formats `data` as a PROGMEM array definition."""
+    return [
+        f'static const {c_type} {name}[{size}] PROGMEM = {{',
+        textwrap.fill('    %s' % (', '.join(map(fmt, data))), width=100, subsequent_indent='    '),
+        '};',
+    ]
+
+
 @cli.argument('filename', type=normpath, help='The autocorrection database file')
 @cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='The keyboard to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('-f', '--format', arg_only=True, choices=['trie', 'double-array'], default='trie', help='The encoding of the trie. double-array is faster to look up and has no size limit, which suits large dictionaries')
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -266,8 +381,6 @@ def generate_autocorrect_data(cli):
     if current_keyboard and current_keymap:
         cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'autocorrect_data.h'
 
-    assert all(0 <= b <= 255 for b in data)
-
     min_typo = min(autocorrections, key=typo_len)[0]
     max_typo = max(autocorrections, key=typo_len)[0]
 
@@ -281,11 +394,27 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
-    autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
-    autocorrect_data_h_lines.append('')
-    autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
-    autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
-    autocorrect_data_h_lines.append('};')
+
+    if cli.args.format == 'double-array':
+        base, check, corrections, leaf = serialize_double_array(trie)
+        base_type = 'uint16_t' if leaf == 0x8000 else 'uint32_t'
+
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_DOUBLE_ARRAY_SIZE {len(base)}')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_CORRECTIONS_SIZE {len(corrections)}')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_LEAF 0x{leaf:X}')
+        autocorrect_data_h_lines.append('')
+        autocorrect_data_h_lines.extend(c_array('autocorrect_base', base_type, 'AUTOCORRECT_DOUBLE_ARRAY_SIZE', base, str))
+        autocorrect_data_h_lines.append('')
+        autocorrect_data_h_lines.extend(c_array('autocorrect_check', 'uint8_t', 'AUTOCORRECT_DOUBLE_ARRAY_SIZE', check, str))
+        autocorrect_data_h_lines.append('')
+        autocorrect_data_h_lines.extend(c_array('autocorrect_corrections', 'uint8_t', 'AUTOCORRECT_CORRECTIONS_SIZE', corrections))
+    else:
+        data = serialize_trie(autocorrections, trie)
+        assert all(0 <= b <= 255 for b in data)
+
+        autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+        autocorrect_data_h_lines.append('')
+        autocorrect_data_h_lines.extend(c_array('autocorrect_data', 'uint8_t', 'DICTIONARY_SIZE', data))
 
     # Show the results
     dump_lines(cli.args.output, autocorrect_data_h_lines, cli.args.quiet)
@@ -520,6 +520,7 @@ void process_action(keyrecord_t *record, action_t action) {
                     } else {
                         if (tap_count > 0) {
                             ac_dprintf("MODS_TAP: Tap: unregister_code\n");
+                            keyboard_report_batch_flush();
                             if (action.layer_tap.code == KC_CAPS_LOCK) {
                                 wait_ms(TAP_HOLD_CAPS_DELAY);
                             } else {
@@ -538,6 +539,7 @@ void process_action(keyrecord_t *record, action_t action) {
 #ifdef EXTRAKEY_ENABLE
         /* other HID usage */
         case ACT_USAGE:
+            keyboard_report_batch_flush();
             switch (action.usage.page) {
                 case PAGE_SYSTEM:
                     host_system_send(event.pressed ? action.usage.code : 0);
@@ -695,6 +697,7 @@ void process_action(keyrecord_t *record, action_t action) {
                     } else {
                         if (tap_count > 0) {
                             ac_dprintf("KEYMAP_TAP_KEY: Tap: unregister_code\n");
+                            keyboard_report_batch_flush();
                             if (action.layer_tap.code == KC_CAPS_LOCK) {
                                 wait_ms(TAP_HOLD_CAPS_DELAY);
                             } else {
@@ -712,6 +715,7 @@ void process_action(keyrecord_t *record, action_t action) {
                         register_code(action.layer_tap.code);
                     } else {
                         ac_dprintf("KEYMAP_TAP_KEY: Tap: unregister_code\n");
+                        keyboard_report_batch_flush();
                         if (action.layer_tap.code == KC_CAPS) {
                             wait_ms(TAP_HOLD_CAPS_DELAY);
                         } else {
@@ -785,6 +789,7 @@ void process_action(keyrecord_t *record, action_t action) {
                         if (event.pressed) {
                             register_code(action.swap.code);
                         } else {
+                            keyboard_report_batch_flush();
                             wait_ms(TAP_CODE_DELAY);
                             unregister_code(action.swap.code);
                             *record = (keyrecord_t){}; // hack: reset tap mode
@@ -886,6 +891,7 @@ __attribute__((weak)) void register_code(uint8_t code) {
 #    endif
         add_key(KC_CAPS_LOCK);
         send_keyboard_report();
+        keyboard_report_batch_flush();
         wait_ms(TAP_HOLD_CAPS_DELAY);
         del_key(KC_CAPS_LOCK);
         send_keyboard_report();
@@ -896,6 +902,7 @@ __attribute__((weak)) void register_code(uint8_t code) {
 #    endif
         add_key(KC_NUM_LOCK);
         send_keyboard_report();
+        keyboard_report_batch_flush();
         wait_ms(100);
         del_key(KC_NUM_LOCK);
         send_keyboard_report();
@@ -906,6 +913,7 @@ __attribute__((weak)) void register_code(uint8_t code) {
 #    endif
         add_key(KC_SCROLL_LOCK);
         send_keyboard_report();
+        keyboard_report_batch_flush();
         wait_ms(100);
         del_key(KC_SCROLL_LOCK);
         send_keyboard_report();
@@ -930,8 +938,10 @@ __attribute__((weak)) void register_code(uint8_t code) {
 
 #ifdef EXTRAKEY_ENABLE
     } else if (IS_SYSTEM_KEYCODE(code)) {
+        keyboard_report_batch_flush();
         host_system_send(KEYCODE2SYSTEM(code));
     } else if (IS_CONSUMER_KEYCODE(code)) {
+        keyboard_report_batch_flush();
         host_consumer_send(KEYCODE2CONSUMER(code));
 #endif
 
@@ -987,8 +997,10 @@ __attribute__((weak)) void unregister_code(uint8_t code) {
 
 #ifdef EXTRAKEY_ENABLE
     } else if (IS_SYSTEM_KEYCODE(code)) {
+        keyboard_report_batch_flush();
         host_system_send(0);
     } else if (IS_CONSUMER_KEYCODE(code)) {
+        keyboard_report_batch_flush();
         host_consumer_send(0);
 #endif
 
@@ -1004,6 +1016,7 @@ __attribute__((weak)) void unregister_code(uint8_t code) {
  */
 __attribute__((weak)) void tap_code_delay(uint8_t code, uint16_t delay) {
     register_code(code);
+    keyboard_report_batch_flush();
     for (uint16_t i = delay; i > 0; i--) {
         wait_ms(1);
     }
@@ -1086,6 +1099,7 @@ void clear_keyboard_but_mods(void) {
  */
 void clear_keyboard_but_mods_and_keys(void) {
 #ifdef EXTRAKEY_ENABLE
+    keyboard_report_batch_flush();
     host_system_send(0);
     host_consumer_send(0);
 #endif
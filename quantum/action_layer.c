@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -316,6 +317,46 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+/* Cache of the resolved layer of every matrix position. Entries are filled in
+ * the first time a position is looked up, and dropped once the layer state
+ * changes in a way that can affect them. */
+static layer_state_t lookup_cache_state = 0;
+static matrix_row_t  lookup_cache_valid[MATRIX_ROWS];
+static uint8_t       lookup_cache_layer[MATRIX_ROWS][MATRIX_COLS];
+
+/** \brief Layer lookup cache clear
+ *
+ * Drops every cached entry, must be called whenever the keymap itself changes
+ */
+void layer_lookup_cache_clear(void) {
+    memset(lookup_cache_valid, 0, sizeof(lookup_cache_valid));
+}
+
+/** \brief Layer lookup cache update
+ *
+ * Drops only the entries that a change of the active layers can affect: those
+ * with a changed layer above the cached one, or whose cached layer was turned off
+ */
+static void layer_lookup_cache_update(layer_state_t layers) {
+    const layer_state_t changed = lookup_cache_state ^ layers;
+    lookup_cache_state          = layers;
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (!lookup_cache_valid[row]) {
+            continue;
+        }
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            const uint8_t layer = lookup_cache_layer[row][col];
+            // Layer 0 is also the fallback, so toggling it never changes the result
+            if ((changed >> layer) > (layer == 0 ? 1 : 0)) {
+                lookup_cache_valid[row] &= ~((matrix_row_t)1 << col);
+            }
+        }
+    }
+}
+#endif
+
 /** \brief Layer switch get layer
  *
  * Gets the layer based on key info
@@ -326,17 +367,38 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action.code = ACTION_TRANSPARENT;
 
     layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_LOOKUP_CACHE
+    const bool cacheable = key.row < MATRIX_ROWS && key.col < MATRIX_COLS;
+    if (cacheable) {
+        if (layers != lookup_cache_state) {
+            layer_lookup_cache_update(layers);
+        }
+        if (lookup_cache_valid[key.row] & ((matrix_row_t)1 << key.col)) {
+            return lookup_cache_layer[key.row][key.col];
+        }
+    }
+#    endif
+
     /* check top layer first */
-    for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
+    int8_t i = MAX_LAYER - 1;
+    for (; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
             action = action_for_key(i, key);
             if (action.code != ACTION_TRANSPARENT) {
-                return i;
+                break;
             }
         }
     }
     /* fall back to layer 0 */
-    return 0;
+    const uint8_t layer = i < 0 ? 0 : i;
+
+#    ifdef LAYER_LOOKUP_CACHE
+    if (cacheable) {
+        lookup_cache_layer[key.row][key.col] = layer;
+        lookup_cache_valid[key.row] |= ((matrix_row_t)1 << key.col);
+    }
+#    endif
+    return layer;
 #else
     return get_highest_layer(default_layer_state);
 #endif
@@ -165,5 +165,12 @@ action_t store_or_get_action(bool pressed, keypos_t key);
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+/* forget all cached layer lookups, call after changing the keymap */
+void layer_lookup_cache_clear(void);
+#else
+#    define layer_lookup_cache_clear()
+#endif
+
 /* return action depending on current layer status */
 action_t layer_switch_get_action(keypos_t key);
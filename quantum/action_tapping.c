@@ -6,6 +6,7 @@
 #include "action_tapping.h"
 #include "keycode.h"
 #include "timer.h"
+#include "task_profiler.h"
 
 #ifndef NO_ACTION_TAPPING
 
@@ -59,10 +60,18 @@ __attribute__((weak)) bool get_hold_on_other_key_press(uint16_t keycode, keyreco
 #        include "process_auto_shift.h"
 #    endif
 
+_Static_assert(WAITING_BUFFER_SIZE >= 2 && WAITING_BUFFER_SIZE <= 128 && (WAITING_BUFFER_SIZE & (WAITING_BUFFER_SIZE - 1)) == 0, "WAITING_BUFFER_SIZE must be a power of two between 2 and 128");
+
+/* The head and tail indices run freely and are masked on access, so that all
+ * WAITING_BUFFER_SIZE slots can be used and head - tail is the fill level. */
+#    define WAITING_BUFFER_MASK (WAITING_BUFFER_SIZE - 1)
+#    define WAITING_BUFFER_AT(i) waiting_buffer[(i) & WAITING_BUFFER_MASK]
+
 static keyrecord_t tapping_key                         = {};
 static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
+static uint16_t    waiting_buffer_overflows            = 0;
 
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
@@ -98,10 +107,10 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
-        if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
-            ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
-            debug_record(waiting_buffer[waiting_buffer_tail]);
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail++) {
+        if (process_tapping(&WAITING_BUFFER_AT(waiting_buffer_tail))) {
+            ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail & WAITING_BUFFER_MASK);
+            debug_record(WAITING_BUFFER_AT(waiting_buffer_tail));
             ac_dprintf("\n\n");
         } else {
             break;
@@ -441,26 +450,38 @@ bool process_tapping(keyrecord_t *keyp) {
 
 /** \brief Waiting buffer enq
  *
- * FIXME: Needs docs
+ * Appends a record in constant time, returns false if the buffer is full
  */
 bool waiting_buffer_enq(keyrecord_t record) {
     if (IS_NOEVENT(record.event)) {
         return true;
     }
 
-    if ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
+    if ((uint8_t)(waiting_buffer_head - waiting_buffer_tail) == WAITING_BUFFER_SIZE) {
         ac_dprintf("waiting_buffer_enq: Over flow.\n");
+        if (waiting_buffer_overflows < UINT16_MAX) {
+            waiting_buffer_overflows++;
+        }
+        task_profiler_count_event(TASK_PROFILER_EVENT_WAITING_BUFFER_OVERFLOW);
         return false;
     }
 
-    waiting_buffer[waiting_buffer_head] = record;
-    waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    WAITING_BUFFER_AT(waiting_buffer_head) = record;
+    waiting_buffer_head++;
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
     return true;
 }
 
+/** \brief Waiting buffer overflow count
+ *
+ * Number of key events that did not fit into the waiting buffer since startup
+ */
+uint16_t waiting_buffer_overflow_count(void) {
+    return waiting_buffer_overflows;
+}
+
 /** \brief Waiting buffer clear
  *
  * FIXME: Needs docs
@@ -475,8 +496,8 @@ void waiting_buffer_clear(void) {
  * FIXME: Needs docs
  */
 bool waiting_buffer_typed(keyevent_t event) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i++) {
+        if (KEYEQ(event.key, WAITING_BUFFER_AT(i).event.key) && event.pressed != WAITING_BUFFER_AT(i).event.pressed) {
             return true;
         }
     }
@@ -488,8 +509,8 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (waiting_buffer[i].event.pressed) return true;
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i++) {
+        if (WAITING_BUFFER_AT(i).event.pressed) return true;
     }
     return false;
 }
@@ -506,14 +527,14 @@ void waiting_buffer_scan_tap(void) {
         return;
     }
 
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        keyrecord_t *candidate = &waiting_buffer[i];
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i++) {
+        keyrecord_t *candidate = &WAITING_BUFFER_AT(i);
         if (IS_EVENT(candidate->event) && KEYEQ(candidate->event.key, tapping_key.event.key) && !candidate->event.pressed && WITHIN_TAPPING_TERM(candidate->event)) {
             tapping_key.tap.count = 1;
             candidate->tap.count  = 1;
             process_record(&tapping_key);
 
-            ac_dprintf("waiting_buffer_scan_tap: found at [%u]\n", i);
+            ac_dprintf("waiting_buffer_scan_tap: found at [%u]\n", i & WAITING_BUFFER_MASK);
             debug_waiting_buffer();
             return;
         }
@@ -536,9 +557,9 @@ static void debug_tapping_key(void) {
  */
 static void debug_waiting_buffer(void) {
     ac_dprintf("{ ");
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        ac_dprintf("[%u]=", i);
-        debug_record(waiting_buffer[i]);
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i++) {
+        ac_dprintf("[%u]=", i & WAITING_BUFFER_MASK);
+        debug_record(WAITING_BUFFER_AT(i));
         ac_dprintf(" ");
     }
     ac_dprintf("}\n");
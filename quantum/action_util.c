@@ -252,6 +252,99 @@ bool is_oneshot_enabled(void) {
 
 #endif
 
+static report_keyboard_t last_report;
+
+/** \brief Send a finished keyboard report to the host
+ *
+ * Skips reports that would not change anything on the host
+ */
+static void send_report_to_host(report_keyboard_t *report) {
+#ifdef PROTOCOL_VUSB
+    memcpy(&last_report, report, sizeof(report_keyboard_t));
+    host_keyboard_send(report);
+#else
+    /* Only send the report if there are changes to propagate to the host. */
+    if (memcmp(report, &last_report, sizeof(report_keyboard_t)) != 0) {
+        memcpy(&last_report, report, sizeof(report_keyboard_t));
+        host_keyboard_send(report);
+    }
+#endif
+}
+
+#ifdef KEYBOARD_REPORT_BATCHING
+static bool              batching      = false;
+static bool              batch_pending = false;
+static report_keyboard_t batch_report  = {};
+
+/** \brief Would replacing the pending report hide a change from the host
+ *
+ * True if a key or modifier pressed within the batch is gone again in the
+ * next report, or one released within the batch is back, so that the
+ * pending report has to be sent first to keep that press or release.
+ */
+static bool batch_hides_change(report_keyboard_t *pending, report_keyboard_t *next) {
+    const uint8_t mods_pressed  = pending->mods & ~last_report.mods;
+    const uint8_t mods_released = last_report.mods & ~pending->mods;
+    if ((mods_pressed & ~next->mods) || (mods_released & next->mods)) {
+        return true;
+    }
+
+#    ifdef NKRO_ENABLE
+    if (keyboard_protocol && keymap_config.nkro) {
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_BITS; i++) {
+            const uint8_t pressed  = pending->nkro.bits[i] & ~last_report.nkro.bits[i];
+            const uint8_t released = last_report.nkro.bits[i] & ~pending->nkro.bits[i];
+            if ((pressed & ~next->nkro.bits[i]) || (released & next->nkro.bits[i])) {
+                return true;
+            }
+        }
+        return false;
+    }
+#    endif
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        const uint8_t pending_key = pending->keys[i];
+        if (pending_key && !is_key_pressed(&last_report, pending_key) && !is_key_pressed(next, pending_key)) {
+            return true;
+        }
+        const uint8_t sent_key = last_report.keys[i];
+        if (sent_key && !is_key_pressed(pending, sent_key) && is_key_pressed(next, sent_key)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** \brief Start collecting keyboard reports
+ *
+ * Until keyboard_report_batch_end() is called, send_keyboard_report() only
+ * sends a report when that is needed to keep presses and releases of the
+ * same key apart, everything else goes out as a single report at the end.
+ */
+void keyboard_report_batch_begin(void) {
+    batching = true;
+}
+
+/** \brief Send the pending report right away but keep collecting
+ *
+ * Called before anything that blocks or sends another kind of report, so
+ * that e.g. the press of a tap_code() with TAP_CODE_DELAY reaches the host
+ * before the delay instead of together with its release.
+ */
+void keyboard_report_batch_flush(void) {
+    if (batch_pending) {
+        batch_pending = false;
+        send_report_to_host(&batch_report);
+    }
+}
+
+/** \brief Stop collecting keyboard reports and send the pending one
+ */
+void keyboard_report_batch_end(void) {
+    batching = false;
+    keyboard_report_batch_flush();
+}
+#endif
+
 /** \brief Send keyboard report
  *
  * FIXME: needs doc
@@ -282,17 +375,18 @@ void send_keyboard_report(void) {
     keyboard_report->mods |= weak_override_mods;
 #endif
 
-#ifdef PROTOCOL_VUSB
-    host_keyboard_send(keyboard_report);
-#else
-    static report_keyboard_t last_report;
-
-    /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(keyboard_report, &last_report, sizeof(report_keyboard_t)) != 0) {
-        memcpy(&last_report, keyboard_report, sizeof(report_keyboard_t));
-        host_keyboard_send(keyboard_report);
+#ifdef KEYBOARD_REPORT_BATCHING
+    if (batching) {
+        if (batch_pending && batch_hides_change(&batch_report, keyboard_report)) {
+            send_report_to_host(&batch_report);
+        }
+        memcpy(&batch_report, keyboard_report, sizeof(report_keyboard_t));
+        batch_pending = true;
+        return;
     }
 #endif
+
+    send_report_to_host(keyboard_report);
 }
 
 /** \brief Get mods
@@ -29,6 +29,16 @@ extern report_keyboard_t *keyboard_report;
 
 void send_keyboard_report(void);
 
+#ifdef KEYBOARD_REPORT_BATCHING
+void keyboard_report_batch_begin(void);
+void keyboard_report_batch_end(void);
+void keyboard_report_batch_flush(void);
+#else
+#    define keyboard_report_batch_begin()
+#    define keyboard_report_batch_end()
+#    define keyboard_report_batch_flush()
+#endif
+
 /* key */
 inline void add_key(uint8_t key) {
     add_key_to_report(keyboard_report, key);
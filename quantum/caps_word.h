@@ -20,7 +20,7 @@
 #    define CAPS_WORD_IDLE_TIMEOUT 5000 // Default timeout of 5 seconds.
 #endif
 
-/** @brief Matrix scan task for Caps Word feature */
+/** @brief Turns Caps Word off once its idle timeout has expired, called by the timeout service */
 void caps_word_task(void);
 
 #if CAPS_WORD_IDLE_TIMEOUT > 0
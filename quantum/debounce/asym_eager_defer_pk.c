@@ -20,6 +20,7 @@
 /*
 Basic symmetric per-key algorithm. Uses an 8-bit counter per key.
 When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+Only the keys in the active list are counted down, so idle keys cost nothing.
 */
 
 #include "matrix.h"
@@ -50,8 +51,17 @@ typedef struct {
     uint8_t time : 7;
 } debounce_counter_t;
 
+#if MATRIX_ROWS * MATRIX_COLS > UINT8_MAX + 1
+typedef uint16_t debounce_index_t;
+#else
+typedef uint8_t debounce_index_t;
+#endif
+
 #if DEBOUNCE > 0
 static debounce_counter_t *debounce_counters;
+// Keys with a running counter, in no particular order
+static debounce_index_t   *active_keys;
+static uint16_t            active_count;
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                matrix_need_update;
@@ -59,7 +69,7 @@ static bool                cooked_changed;
 
 #    define DEBOUNCE_ELAPSED 0
 
-static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t elapsed_time);
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
@@ -71,11 +81,15 @@ void debounce_init(uint8_t num_rows) {
             debounce_counters[i++].time = DEBOUNCE_ELAPSED;
         }
     }
+    active_keys  = (debounce_index_t *)malloc(num_rows * MATRIX_COLS * sizeof(debounce_index_t));
+    active_count = 0;
 }
 
 void debounce_free(void) {
     free(debounce_counters);
     debounce_counters = NULL;
+    free(active_keys);
+    active_keys = NULL;
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
@@ -93,7 +107,7 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
         }
 
         if (elapsed_time > 0) {
-            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, elapsed_time);
         }
     }
 
@@ -108,66 +122,72 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
     return cooked_changed;
 }
 
-static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
-
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t elapsed_time) {
     counters_need_update = false;
     matrix_need_update   = false;
 
-    for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            matrix_row_t col_mask = (ROW_SHIFTER << col);
-
-            if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
-                if (debounce_pointer->time <= elapsed_time) {
-                    debounce_pointer->time = DEBOUNCE_ELAPSED;
-
-                    if (debounce_pointer->pressed) {
-                        // key-down: eager
-                        matrix_need_update = true;
-                    } else {
-                        // key-up: defer
-                        matrix_row_t cooked_next = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
-                        cooked_changed |= cooked_next ^ cooked[row];
-                        cooked[row] = cooked_next;
-                    }
-                } else {
-                    debounce_pointer->time -= elapsed_time;
-                    counters_need_update = true;
-                }
+    for (uint16_t i = 0; i < active_count;) {
+        debounce_index_t    index            = active_keys[i];
+        debounce_counter_t *debounce_pointer = &debounce_counters[index];
+
+        if (debounce_pointer->time <= elapsed_time) {
+            debounce_pointer->time = DEBOUNCE_ELAPSED;
+            active_keys[i]         = active_keys[--active_count];
+
+            if (debounce_pointer->pressed) {
+                // key-down: eager
+                matrix_need_update = true;
+            } else {
+                // key-up: defer
+                uint8_t      row         = index / MATRIX_COLS;
+                matrix_row_t col_mask    = ROW_SHIFTER << (index % MATRIX_COLS);
+                matrix_row_t cooked_next = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
+                cooked_changed |= cooked_next ^ cooked[row];
+                cooked[row] = cooked_next;
             }
-            debounce_pointer++;
+        } else {
+            debounce_pointer->time -= elapsed_time;
+            counters_need_update = true;
+            i++;
         }
     }
 }
 
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
+    // key-up: defer, stop the counters of released keys that went back to pressed
+    for (uint16_t i = 0; i < active_count;) {
+        debounce_index_t    index            = active_keys[i];
+        debounce_counter_t *debounce_pointer = &debounce_counters[index];
+        uint8_t             row              = index / MATRIX_COLS;
+        matrix_row_t        col_mask         = ROW_SHIFTER << (index % MATRIX_COLS);
+
+        if (!debounce_pointer->pressed && !((raw[row] ^ cooked[row]) & col_mask)) {
+            debounce_pointer->time = DEBOUNCE_ELAPSED;
+            active_keys[i]         = active_keys[--active_count];
+        } else {
+            i++;
+        }
+    }
 
     for (uint8_t row = 0; row < num_rows; row++) {
         matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            matrix_row_t col_mask = (ROW_SHIFTER << col);
-
-            if (delta & col_mask) {
-                if (debounce_pointer->time == DEBOUNCE_ELAPSED) {
-                    debounce_pointer->pressed = (raw[row] & col_mask);
-                    debounce_pointer->time    = DEBOUNCE;
-                    counters_need_update      = true;
-
-                    if (debounce_pointer->pressed) {
-                        // key-down: eager
-                        cooked[row] ^= col_mask;
-                        cooked_changed = true;
-                    }
-                }
-            } else if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
-                if (!debounce_pointer->pressed) {
-                    // key-up: defer
-                    debounce_pointer->time = DEBOUNCE_ELAPSED;
+        for (uint8_t col = 0; delta; col++, delta >>= 1) {
+            debounce_index_t    index            = row * MATRIX_COLS + col;
+            debounce_counter_t *debounce_pointer = &debounce_counters[index];
+            matrix_row_t        col_mask         = (ROW_SHIFTER << col);
+
+            if ((delta & 1) && debounce_pointer->time == DEBOUNCE_ELAPSED) {
+                debounce_pointer->pressed   = (raw[row] & col_mask);
+                debounce_pointer->time      = DEBOUNCE;
+                active_keys[active_count++] = index;
+                counters_need_update        = true;
+
+                if (debounce_pointer->pressed) {
+                    // key-down: eager
+                    cooked[row] ^= col_mask;
+                    cooked_changed = true;
                 }
             }
-            debounce_pointer++;
         }
     }
 }
@@ -17,6 +17,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 /*
 Basic symmetric per-key algorithm. Uses an 8-bit counter per key.
 When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+Only the keys in the active list are counted down, so idle keys cost nothing.
 */
 
 #include "matrix.h"
@@ -44,15 +45,24 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 
 typedef uint8_t debounce_counter_t;
 
+#if MATRIX_ROWS * MATRIX_COLS > UINT8_MAX + 1
+typedef uint16_t debounce_index_t;
+#else
+typedef uint8_t debounce_index_t;
+#endif
+
 #if DEBOUNCE > 0
 static debounce_counter_t *debounce_counters;
+// Keys with a running counter, in no particular order
+static debounce_index_t   *active_keys;
+static uint16_t            active_count;
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                cooked_changed;
 
 #    define DEBOUNCE_ELAPSED 0
 
-static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t elapsed_time);
 static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
@@ -64,11 +74,15 @@ void debounce_init(uint8_t num_rows) {
             debounce_counters[i++] = DEBOUNCE_ELAPSED;
         }
     }
+    active_keys  = (debounce_index_t *)malloc(num_rows * MATRIX_COLS * sizeof(debounce_index_t));
+    active_count = 0;
 }
 
 void debounce_free(void) {
     free(debounce_counters);
     debounce_counters = NULL;
+    free(active_keys);
+    active_keys = NULL;
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
@@ -86,7 +100,7 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
         }
 
         if (elapsed_time > 0) {
-            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, elapsed_time);
         }
     }
 
@@ -101,41 +115,51 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
     return cooked_changed;
 }
 
-static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
-    counters_need_update                 = false;
-    debounce_counter_t *debounce_pointer = debounce_counters;
-    for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            if (*debounce_pointer != DEBOUNCE_ELAPSED) {
-                if (*debounce_pointer <= elapsed_time) {
-                    *debounce_pointer        = DEBOUNCE_ELAPSED;
-                    matrix_row_t cooked_next = (cooked[row] & ~(ROW_SHIFTER << col)) | (raw[row] & (ROW_SHIFTER << col));
-                    cooked_changed |= cooked[row] ^ cooked_next;
-                    cooked[row] = cooked_next;
-                } else {
-                    *debounce_pointer -= elapsed_time;
-                    counters_need_update = true;
-                }
-            }
-            debounce_pointer++;
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint16_t i = 0; i < active_count;) {
+        debounce_index_t    index            = active_keys[i];
+        debounce_counter_t *debounce_pointer = &debounce_counters[index];
+        if (*debounce_pointer <= elapsed_time) {
+            uint8_t      row         = index / MATRIX_COLS;
+            matrix_row_t col_mask    = ROW_SHIFTER << (index % MATRIX_COLS);
+            matrix_row_t cooked_next = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row]       = cooked_next;
+            *debounce_pointer = DEBOUNCE_ELAPSED;
+            active_keys[i]    = active_keys[--active_count];
+        } else {
+            *debounce_pointer -= elapsed_time;
+            counters_need_update = true;
+            i++;
         }
     }
 }
 
 static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
+    // Stop the counters of keys that went back to their debounced state
+    for (uint16_t i = 0; i < active_count;) {
+        debounce_index_t index    = active_keys[i];
+        uint8_t          row      = index / MATRIX_COLS;
+        matrix_row_t     col_mask = ROW_SHIFTER << (index % MATRIX_COLS);
+        if (!((raw[row] ^ cooked[row]) & col_mask)) {
+            debounce_counters[index] = DEBOUNCE_ELAPSED;
+            active_keys[i]           = active_keys[--active_count];
+        } else {
+            i++;
+        }
+    }
+
+    // Start the counters of keys that changed
     for (uint8_t row = 0; row < num_rows; row++) {
         matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            if (delta & (ROW_SHIFTER << col)) {
-                if (*debounce_pointer == DEBOUNCE_ELAPSED) {
-                    *debounce_pointer    = DEBOUNCE;
-                    counters_need_update = true;
-                }
-            } else {
-                *debounce_pointer = DEBOUNCE_ELAPSED;
+        for (uint8_t col = 0; delta; col++, delta >>= 1) {
+            debounce_index_t index = row * MATRIX_COLS + col;
+            if ((delta & 1) && debounce_counters[index] == DEBOUNCE_ELAPSED) {
+                debounce_counters[index]    = DEBOUNCE;
+                active_keys[active_count++] = index;
+                counters_need_update        = true;
             }
-            debounce_pointer++;
         }
     }
 }
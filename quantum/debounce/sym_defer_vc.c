@@ -0,0 +1,164 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Symmetric per-key algorithm using vertical counters, with the same behaviour as sym_defer_pk.
+When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+
+Instead of one 8-bit counter per key, bit n of every key's counter is kept in
+one matrix_row_t per row. Starting, clearing and counting down the counters
+of a whole row then takes a fixed number of word operations, no matter how
+many of its keys are bouncing.
+*/
+
+#include "matrix.h"
+#include "timer.h"
+#include "quantum.h"
+#include <string.h>
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE < 2
+#    define DEBOUNCE_COUNTER_BITS 1
+#elif DEBOUNCE < 4
+#    define DEBOUNCE_COUNTER_BITS 2
+#elif DEBOUNCE < 8
+#    define DEBOUNCE_COUNTER_BITS 3
+#elif DEBOUNCE < 16
+#    define DEBOUNCE_COUNTER_BITS 4
+#elif DEBOUNCE < 32
+#    define DEBOUNCE_COUNTER_BITS 5
+#elif DEBOUNCE < 64
+#    define DEBOUNCE_COUNTER_BITS 6
+#elif DEBOUNCE < 128
+#    define DEBOUNCE_COUNTER_BITS 7
+#else
+#    define DEBOUNCE_COUNTER_BITS 8
+#endif
+
+#if DEBOUNCE > 0
+// [row][bit] bit of the milliseconds left until each key is debounced, 0 when idle
+static matrix_row_t debounce_counters[MATRIX_ROWS][DEBOUNCE_COUNTER_BITS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    memset(debounce_counters, 0, sizeof(debounce_counters));
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        // Every running counter expires after DEBOUNCE, so it is the most that needs subtracting
+        if (elapsed_time > DEBOUNCE) {
+            elapsed_time = DEBOUNCE;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *counter = debounce_counters[row];
+
+        matrix_row_t running = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+            running |= counter[bit];
+        }
+        if (!running) {
+            continue;
+        }
+
+        // Subtract elapsed_time from every counter of the row at once, rippling the borrow through the bits
+        matrix_row_t borrow    = 0;
+        matrix_row_t remaining = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+            matrix_row_t subtrahend = (elapsed_time & (1 << bit)) ? (matrix_row_t)~0 : 0;
+            matrix_row_t difference = counter[bit] ^ subtrahend ^ borrow;
+
+            borrow       = (~counter[bit] & (subtrahend | borrow)) | (subtrahend & borrow);
+            counter[bit] = difference;
+            remaining |= difference;
+        }
+
+        // A counter expires when it reaches or passes zero
+        matrix_row_t expired = running & (borrow | ~remaining);
+        for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+            counter[bit] &= running & ~expired;
+        }
+
+        if (expired) {
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+        if (running & ~expired) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *counter = debounce_counters[row];
+        matrix_row_t  delta   = raw[row] ^ cooked[row];
+
+        matrix_row_t running = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+            running |= counter[bit];
+        }
+
+        // Start the idle counters of changed keys, stop the counters of keys that changed back
+        matrix_row_t start = delta & ~running;
+        for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+            counter[bit] &= delta;
+            if (DEBOUNCE & (1 << bit)) {
+                counter[bit] |= start;
+            }
+        }
+        if (start) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -392,3 +392,22 @@ TEST_F(DebounceTest, OneKeyDelayedScan8) {
     time_jumps_ = true;
     runEvents();
 }
+
+TEST_F(DebounceTest, ManyKeysStaggered) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {{0, 1, DOWN}}},
+        {1, {{2, 3, DOWN}}, {{2, 3, DOWN}}},
+        {2, {{3, 9, DOWN}}, {{3, 9, DOWN}}},
+
+        {10, {{2, 3, UP}}, {}},
+        {11, {{3, 9, UP}}, {}},
+        {12, {{0, 1, UP}}, {}},
+        /* Bounce in the middle of the active keys */
+        {13, {{3, 9, DOWN}}, {}},
+
+        {15, {}, {{2, 3, UP}}},
+        {17, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
@@ -0,0 +1,9 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Builds asym_eager_defer_pk under its own names, so that every algorithm can be linked into one benchmark
+#define debounce_init debounce_asym_eager_defer_pk_init
+#define debounce_free debounce_asym_eager_defer_pk_free
+#define debounce debounce_asym_eager_defer_pk
+
+#include "../../asym_eager_defer_pk.c"
@@ -0,0 +1,9 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Builds sym_defer_pk under its own names, so that every algorithm can be linked into one benchmark
+#define debounce_init debounce_sym_defer_pk_init
+#define debounce_free debounce_sym_defer_pk_free
+#define debounce debounce_sym_defer_pk
+
+#include "../../sym_defer_pk.c"
@@ -0,0 +1,238 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+extern "C" {
+#include "matrix.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* Replays synthetic bounce patterns through every debounce algorithm on a
+ * MATRIX_ROWS x MATRIX_COLS matrix and prints the host CPU time spent in
+ * debounce() per scan, the worst scan, and how many milliseconds after the
+ * physical change the debounced matrix followed. The CPU numbers are only
+ * meaningful relative to each other, the latency numbers are exact. */
+
+// clang-format off
+#define DEBOUNCE_BENCHMARK_ALGORITHMS(X) \
+    X(sym_defer_g)                       \
+    X(sym_defer_pr)                      \
+    X(sym_defer_pk)                      \
+    X(sym_defer_vc)                      \
+    X(sym_eager_pr)                      \
+    X(sym_eager_pk)                      \
+    X(asym_eager_defer_pk)
+// clang-format on
+
+#define DEBOUNCE_BENCHMARK_DECLARE(name)           \
+    void debounce_##name##_init(uint8_t num_rows); \
+    void debounce_##name##_free(void);             \
+    bool debounce_##name(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed);
+
+extern "C" {
+DEBOUNCE_BENCHMARK_ALGORITHMS(DEBOUNCE_BENCHMARK_DECLARE)
+}
+
+#define DEBOUNCE_BENCHMARK_ENTRY(name) {#name, debounce_##name##_init, debounce_##name##_free, debounce_##name},
+
+struct Algorithm {
+    const char *name;
+    void (*init)(uint8_t num_rows);
+    void (*free)(void);
+    bool (*debounce)(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed);
+};
+
+static const Algorithm algorithms[] = {DEBOUNCE_BENCHMARK_ALGORITHMS(DEBOUNCE_BENCHMARK_ENTRY)};
+
+enum class Pattern {
+    IDLE,     // nothing moves
+    TYPING,   // a key is pressed about every 15ms and held for 40-120ms
+    ALL_KEYS, // every key is pressed and released at once, the worst case
+};
+
+struct Results {
+    uint32_t scans       = 0;
+    uint64_t total_ns    = 0;
+    uint64_t worst_ns    = 0;
+    uint32_t transitions = 0;
+    uint64_t latency_sum = 0;
+    uint32_t latency_max = 0;
+    uint32_t missed      = 0;
+    uint32_t glitches    = 0;
+};
+
+class DebounceBenchmark : public ::testing::Test {
+   protected:
+    static const uint16_t KEYS         = MATRIX_ROWS * MATRIX_COLS;
+    static const uint32_t DURATION     = 2000; // ms of input per run
+    static const uint32_t SETTLE       = 300;  // ms of silence after the input
+    static const uint8_t  SCANS_PER_MS = 4;
+    static const uint8_t  MAX_BOUNCE   = 3; // ms of chatter after each change
+
+    struct Key {
+        bool     stable;        // physical state once the contacts settle
+        uint32_t bounce_until;  // chatter until this time
+        uint32_t release_at;    // when a pressed key is let go
+        bool     pending;       // waiting for the cooked matrix to follow
+        uint32_t changed_at;    // time of the change that is pending
+    };
+
+    uint32_t seed_;
+    uint32_t now_;
+    Key      keys_[KEYS];
+
+    uint32_t random() {
+        seed_ = seed_ * 1664525 + 1013904223;
+        return seed_ >> 8;
+    }
+
+    void change(uint16_t k, bool pressed, Results &results) {
+        Key &key = keys_[k];
+        if (key.pending) {
+            results.missed++;
+        }
+        key.stable       = pressed;
+        key.bounce_until = now_ + random() % (MAX_BOUNCE + 1);
+        key.pending      = true;
+        key.changed_at   = now_;
+        results.transitions++;
+    }
+
+    void tick(Pattern pattern, Results &results) {
+        if (now_ >= DURATION) {
+            return;
+        }
+        switch (pattern) {
+            case Pattern::IDLE:
+                break;
+            case Pattern::TYPING:
+                for (uint16_t k = 0; k < KEYS; k++) {
+                    if (keys_[k].stable && keys_[k].release_at == now_) {
+                        change(k, false, results);
+                    }
+                }
+                if (random() % 15 == 0) {
+                    uint16_t k = random() % KEYS;
+                    if (!keys_[k].stable && !keys_[k].pending) {
+                        keys_[k].release_at = now_ + 40 + random() % 81;
+                        change(k, true, results);
+                    }
+                }
+                break;
+            case Pattern::ALL_KEYS:
+                if (now_ % 100 == 0 || now_ % 100 == 50) {
+                    for (uint16_t k = 0; k < KEYS; k++) {
+                        change(k, now_ % 100 == 0, results);
+                    }
+                }
+                break;
+        }
+    }
+
+    void sample(matrix_row_t raw[]) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            raw[row] = 0;
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                const Key &key   = keys_[row * MATRIX_COLS + col];
+                bool       state = now_ < key.bounce_until ? (random() & 1) : key.stable;
+                raw[row] |= state ? (MATRIX_ROW_SHIFTER << col) : 0;
+            }
+        }
+    }
+
+    void follow(const matrix_row_t before[], const matrix_row_t after[], Results &results) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            matrix_row_t flipped = before[row] ^ after[row];
+            for (uint8_t col = 0; flipped; col++, flipped >>= 1) {
+                if (!(flipped & 1)) {
+                    continue;
+                }
+                Key &key   = keys_[row * MATRIX_COLS + col];
+                bool state = after[row] & (MATRIX_ROW_SHIFTER << col);
+                if (key.pending && state == key.stable) {
+                    uint32_t latency = now_ - key.changed_at;
+                    results.latency_sum += latency;
+                    results.latency_max = std::max(results.latency_max, latency);
+                    key.pending         = false;
+                } else {
+                    results.glitches++;
+                }
+            }
+        }
+    }
+
+    Results run(const Algorithm &algorithm, Pattern pattern) {
+        Results      results;
+        matrix_row_t raw[MATRIX_ROWS]      = {0};
+        matrix_row_t last_raw[MATRIX_ROWS] = {0};
+        matrix_row_t cooked[MATRIX_ROWS]   = {0};
+        matrix_row_t before[MATRIX_ROWS];
+
+        seed_ = 0x2545F491;
+        now_  = 0;
+        std::fill(std::begin(keys_), std::end(keys_), Key{});
+        set_time(1000);
+        algorithm.init(MATRIX_ROWS);
+
+        for (now_ = 0; now_ < DURATION + SETTLE; now_++) {
+            tick(pattern, results);
+            for (uint8_t scan = 0; scan < SCANS_PER_MS; scan++) {
+                sample(raw);
+                bool changed = memcmp(raw, last_raw, sizeof(raw)) != 0;
+                memcpy(last_raw, raw, sizeof(raw));
+                memcpy(before, cooked, sizeof(cooked));
+
+                auto start = std::chrono::steady_clock::now();
+                algorithm.debounce(raw, cooked, MATRIX_ROWS, changed);
+                auto     end = std::chrono::steady_clock::now();
+                uint64_t ns  = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+                results.scans++;
+                results.total_ns += ns;
+                results.worst_ns = std::max(results.worst_ns, ns);
+                follow(before, cooked, results);
+            }
+            advance_time(1);
+        }
+
+        for (uint16_t k = 0; k < KEYS; k++) {
+            results.missed += keys_[k].pending;
+        }
+        algorithm.free();
+        return results;
+    }
+
+    void benchmark(const char *label, Pattern pattern) {
+        printf("\n%ux%u matrix, DEBOUNCE=%u, %s\n", MATRIX_ROWS, MATRIX_COLS, DEBOUNCE, label);
+        printf("%-20s %10s %10s %12s %12s %8s %8s\n", "algorithm", "ns/scan", "worst ns", "latency avg", "latency max", "missed", "glitches");
+        for (const Algorithm &algorithm : algorithms) {
+            Results results = run(algorithm, pattern);
+            double  average = results.transitions > results.missed ? (double)results.latency_sum / (results.transitions - results.missed) : 0;
+            printf("%-20s %10.1f %10llu %12.1f %12u %8u %8u\n", algorithm.name, (double)results.total_ns / results.scans, (unsigned long long)results.worst_ns, average, results.latency_max, results.missed, results.glitches);
+
+            // Whatever the timing, every algorithm must end up following the input
+            EXPECT_EQ(results.missed, 0u) << algorithm.name << " never reported a change";
+            EXPECT_EQ(results.glitches, 0u) << algorithm.name << " reported a state the key never settled in";
+        }
+    }
+};
+
+TEST_F(DebounceBenchmark, Idle) {
+    benchmark("idle", Pattern::IDLE);
+}
+
+TEST_F(DebounceBenchmark, Typing) {
+    benchmark("typing with up to 3ms of bounce", Pattern::TYPING);
+}
+
+TEST_F(DebounceBenchmark, AllKeys) {
+    benchmark("all keys at once with up to 3ms of bounce", Pattern::ALL_KEYS);
+}
@@ -28,6 +28,12 @@ debounce_sym_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
 
+debounce_sym_defer_vc_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_vc_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_vc.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_vc_tests.cpp
+
 debounce_sym_defer_pr_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_defer_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pr.c \
@@ -47,3 +53,25 @@ debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+DEBOUNCE_BENCHMARK_SRC := $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp \
+	$(QUANTUM_PATH)/debounce/tests/benchmark/sym_defer_g.c \
+	$(QUANTUM_PATH)/debounce/tests/benchmark/sym_defer_pr.c \
+	$(QUANTUM_PATH)/debounce/tests/benchmark/sym_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/benchmark/sym_defer_vc.c \
+	$(QUANTUM_PATH)/debounce/tests/benchmark/sym_eager_pr.c \
+	$(QUANTUM_PATH)/debounce/tests/benchmark/sym_eager_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/benchmark/asym_eager_defer_pk.c
+
+debounce_benchmark_4x4_DEFS := -DMATRIX_ROWS=4 -DMATRIX_COLS=4 -DDEBOUNCE=5
+debounce_benchmark_4x4_SRC := $(DEBOUNCE_BENCHMARK_SRC)
+
+debounce_benchmark_8x8_DEFS := -DMATRIX_ROWS=8 -DMATRIX_COLS=8 -DDEBOUNCE=5
+debounce_benchmark_8x8_SRC := $(DEBOUNCE_BENCHMARK_SRC)
+
+debounce_benchmark_16x16_DEFS := -DMATRIX_ROWS=16 -DMATRIX_COLS=16 -DDEBOUNCE=5
+debounce_benchmark_16x16_SRC := $(DEBOUNCE_BENCHMARK_SRC)
+
+debounce_benchmark_32x32_DEFS := -DMATRIX_ROWS=32 -DMATRIX_COLS=32 -DDEBOUNCE=5
+debounce_benchmark_32x32_SRC := $(DEBOUNCE_BENCHMARK_SRC)
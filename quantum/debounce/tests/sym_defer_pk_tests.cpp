@@ -238,3 +238,18 @@ TEST_F(DebounceTest, OneKeyDelayedScan4) {
     time_jumps_ = true;
     runEvents();
 }
+
+TEST_F(DebounceTest, ManyKeysStaggered) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {1, {{2, 3, DOWN}}, {}},
+        {2, {{3, 9, DOWN}}, {}},
+        /* Bounce in the middle of the active keys */
+        {3, {{2, 3, UP}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        {7, {}, {{3, 9, DOWN}}},
+    });
+    runEvents();
+}
@@ -0,0 +1,64 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+/* sym_defer_vc is also run against all of sym_defer_pk_tests.cpp, these
+ * cover many counters of one row running at different stages at once. */
+
+TEST_F(DebounceTest, VerticalCountersStaggeredRow) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 0, DOWN}}, {}},
+        {1, {{0, 1, DOWN}, {0, 9, DOWN}}, {}},
+        {2, {{0, 2, DOWN}}, {}},
+        {3, {{0, 3, DOWN}, {0, 9, UP}}, {}},
+        {4, {{0, 4, DOWN}}, {}},
+
+        {5, {}, {{0, 0, DOWN}}},
+        {6, {}, {{0, 1, DOWN}}},
+        {7, {}, {{0, 2, DOWN}}},
+        {8, {}, {{0, 3, DOWN}}},
+        {9, {}, {{0, 4, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, VerticalCountersBouncingNeighbour) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{1, 4, DOWN}, {1, 5, DOWN}}, {}},
+        {2, {{1, 5, UP}}, {}},
+        {3, {{1, 5, DOWN}}, {}},
+
+        {5, {}, {{1, 4, DOWN}}},
+        {8, {}, {{1, 5, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, VerticalCountersAllKeys) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 0, DOWN}, {0, 1, DOWN}, {0, 2, DOWN}, {0, 3, DOWN}, {0, 4, DOWN}, {0, 5, DOWN}, {0, 6, DOWN}, {0, 7, DOWN}, {0, 8, DOWN}, {0, 9, DOWN}, {3, 0, DOWN}, {3, 9, DOWN}}, {}},
+
+        {5, {}, {{0, 0, DOWN}, {0, 1, DOWN}, {0, 2, DOWN}, {0, 3, DOWN}, {0, 4, DOWN}, {0, 5, DOWN}, {0, 6, DOWN}, {0, 7, DOWN}, {0, 8, DOWN}, {0, 9, DOWN}, {3, 0, DOWN}, {3, 9, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, VerticalCountersLateScan) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{2, 1, DOWN}}, {}},
+        {2, {{2, 2, DOWN}}, {}},
+
+        /* Processing is a bit late, only the first counter expires */
+        {6, {}, {{2, 1, DOWN}}},
+        {7, {}, {{2, 2, DOWN}}},
+    });
+    time_jumps_ = true;
+    runEvents();
+}
@@ -251,3 +251,19 @@ TEST_F(DebounceTest, OneKeyDelayedScan6) {
     time_jumps_ = true;
     runEvents();
 }
+
+TEST_F(DebounceTest, ManyKeysStaggered) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {{0, 1, DOWN}}},
+        {1, {{2, 3, DOWN}}, {{2, 3, DOWN}}},
+        {2, {{3, 9, DOWN}}, {{3, 9, DOWN}}},
+        /* Release keys before their debounce expires, in press order */
+        {3, {{0, 1, UP}, {2, 3, UP}, {3, 9, UP}}, {}},
+
+        {5, {}, {{0, 1, UP}}},
+        {6, {}, {{2, 3, UP}}},
+        {7, {}, {{3, 9, UP}}},
+    });
+    runEvents();
+}
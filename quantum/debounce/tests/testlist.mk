@@ -1,7 +1,15 @@
 TEST_LIST += \
 	debounce_sym_defer_g \
 	debounce_sym_defer_pk \
+	debounce_sym_defer_vc \
 	debounce_sym_defer_pr \
 	debounce_sym_eager_pk \
 	debounce_sym_eager_pr \
 	debounce_asym_eager_defer_pk
+
+# Only run when asked for by name, e.g. make test:benchmark
+BENCHMARK_LIST += \
+	debounce_benchmark_4x4 \
+	debounce_benchmark_8x8 \
+	debounce_benchmark_16x16 \
+	debounce_benchmark_32x32
@@ -4,11 +4,251 @@
 #include <stddef.h>
 #include <timer.h>
 #include <deferred_exec.h>
+#include <task_scheduler.h>
+#include <util.h>
 
 #ifndef MAX_DEFERRED_EXECUTORS
 #    define MAX_DEFERRED_EXECUTORS 8
 #endif
 
+#ifdef DEFERRED_EXEC_HEAP
+
+//------------------------------------
+// Helpers
+//
+
+static uint16_t token_generation = 0;
+
+// Tokens encode the table slot they were allocated in, so finding an executor never needs to search the table. The
+// generation keeps stale tokens from matching whichever executor reuses the slot later on.
+static inline deferred_token allocate_token(size_t table_count, uint16_t slot) {
+    uint16_t generations = UINT16_MAX / table_count;
+    uint16_t generation  = token_generation++ % generations;
+    return generation * table_count + slot + 1;
+}
+
+static inline deferred_executor_t *find_entry(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return NULL;
+    }
+    deferred_executor_t *entry = &table[(token - 1) % table_count];
+    return entry->token == token ? entry : NULL;
+}
+
+// The queued executors form a binary min-heap ordered by trigger time. Positions [0, heap_count) of the heap hold the
+// queued slots, the remaining positions hold the free slots, so allocating a slot is a matter of taking the first free
+// position. The only exception are executors parked at the end while deferred_exec_advanced_task() invokes them.
+
+static inline uint16_t heap_slot(deferred_executor_t *table, uint16_t position) {
+    return table[position].heap_slot ^ position;
+}
+
+static inline uint16_t heap_position(deferred_executor_t *table, uint16_t slot) {
+    return table[slot].heap_position ^ slot;
+}
+
+static inline void heap_set(deferred_executor_t *table, uint16_t position, uint16_t slot) {
+    table[position].heap_slot = slot ^ position;
+    table[slot].heap_position = position ^ slot;
+}
+
+static inline bool heap_before(deferred_executor_t *table, uint16_t a, uint16_t b) {
+    return ((int32_t)TIMER_DIFF_32(table[heap_slot(table, a)].trigger_time, table[heap_slot(table, b)].trigger_time)) < 0;
+}
+
+static inline void heap_swap(deferred_executor_t *table, uint16_t a, uint16_t b) {
+    uint16_t slot = heap_slot(table, a);
+    heap_set(table, a, heap_slot(table, b));
+    heap_set(table, b, slot);
+}
+
+static void heap_fix(deferred_executor_t *table, uint16_t position) {
+    uint16_t count = table[0].heap_count;
+
+    // Sift up towards the root...
+    while (position > 0 && heap_before(table, position, (position - 1) / 2)) {
+        heap_swap(table, position, (position - 1) / 2);
+        position = (position - 1) / 2;
+    }
+
+    // ...or down towards the leaves
+    while (true) {
+        uint16_t child = 2 * position + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && heap_before(table, child + 1, child)) {
+            ++child;
+        }
+        if (!heap_before(table, child, position)) {
+            break;
+        }
+        heap_swap(table, position, child);
+        position = child;
+    }
+}
+
+static void heap_remove(deferred_executor_t *table, uint16_t position) {
+    uint16_t last = --table[0].heap_count;
+    if (position != last) {
+        heap_swap(table, position, last);
+        heap_fix(table, position);
+    }
+}
+
+static inline bool table_is_valid(deferred_executor_t *table, size_t table_count) {
+    return table && table_count > 0 && table_count <= UINT16_MAX;
+}
+
+//------------------------------------
+// Advanced API: used when a custom-allocated table is used, primarily for core code.
+//
+
+deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+    // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
+    if (!table_is_valid(table, table_count) || delay_ms == 0 || !callback) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+
+    // Claim the first free slot, if any. While deferred_exec_advanced_task() is invoking executors, it may instead hold
+    // a parked executor, in which case the table is full.
+    uint16_t position = table[0].heap_count;
+    if (position >= table_count || table[heap_slot(table, position)].token != INVALID_DEFERRED_TOKEN) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+    uint16_t slot = heap_slot(table, position);
+    ++table[0].heap_count;
+
+    // Set up the executor table entry, and move it to its place in the queue
+    deferred_executor_t *entry = &table[slot];
+    entry->token               = allocate_token(table_count, slot);
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    heap_fix(table, position);
+    return entry->token;
+}
+
+bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
+    // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
+    if (!table_is_valid(table, table_count) || delay_ms == 0) {
+        return false;
+    }
+
+    deferred_executor_t *entry = find_entry(table, table_count, token);
+    if (!entry) {
+        return false;
+    }
+
+    // Parked executors get requeued once deferred_exec_advanced_task() gets to them
+    uint16_t position   = heap_position(table, entry - table);
+    entry->trigger_time = timer_read32() + delay_ms;
+    if (position < table[0].heap_count) {
+        heap_fix(table, position);
+    }
+    return true;
+}
+
+bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    // Ignore request if the table/token are not valid
+    if (!table_is_valid(table, table_count)) {
+        return false;
+    }
+
+    deferred_executor_t *entry = find_entry(table, table_count, token);
+    if (!entry) {
+        return false;
+    }
+
+    uint16_t position = heap_position(table, entry - table);
+    if (position < table[0].heap_count) {
+        heap_remove(table, position);
+    }
+    entry->token        = INVALID_DEFERRED_TOKEN;
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
+    return true;
+}
+
+uint32_t deferred_exec_advanced_next_deadline(deferred_executor_t *table, size_t table_count) {
+    if (!table_is_valid(table, table_count) || table[0].heap_count == 0) {
+        return UINT32_MAX;
+    }
+
+    int32_t remaining = (int32_t)TIMER_DIFF_32(table[heap_slot(table, 0)].trigger_time, timer_read32());
+    return remaining > 0 ? remaining : 0;
+}
+
+void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, deferred_exec_state_t *state) {
+    if (!table_is_valid(table, table_count)) {
+        return;
+    }
+
+    uint32_t now = timer_read32();
+
+    // Throttle only once per millisecond
+    if (((int32_t)TIMER_DIFF_32(now, state->last_execution_time)) > 0) {
+        state->last_execution_time = now;
+
+        // Pop every due executor off the front of the queue and park it at the end of the table, the earliest trigger
+        // ending up in the last position. Parked executors are out of the queue until they're requeued below, so one
+        // that is running behind gets invoked at most once per run and can't starve the rest of the main loop.
+        uint16_t parked = 0;
+        while (table[0].heap_count > 0 && ((int32_t)TIMER_DIFF_32(table[heap_slot(table, 0)].trigger_time, now)) <= 0) {
+            heap_remove(table, 0);
+            heap_swap(table, table[0].heap_count, table_count - 1 - parked);
+            ++parked;
+        }
+
+        // Reverse them so that the earliest trigger comes first. Requeueing a parked executor only ever swaps it with a
+        // free position in front of it, leaving the ones behind it in place.
+        for (uint16_t i = 0; i < parked / 2; ++i) {
+            heap_swap(table, table_count - parked + i, table_count - 1 - i);
+        }
+
+        bool yielded = false;
+        for (uint16_t position = table_count - parked; position < table_count; ++position) {
+            deferred_executor_t *entry = &table[heap_slot(table, position)];
+
+            // Skip anything cancelled while parked
+            if (entry->token == INVALID_DEFERRED_TOKEN) {
+                continue;
+            }
+
+            // Leave any other due executors for the next run if the matrix needs servicing, or if they were extended
+            if (!yielded && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
+                // Invoke the callback and work out if we should be requeued
+                deferred_token token    = entry->token;
+                uint32_t       delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+                yielded                 = task_scheduler_should_yield();
+
+                // The callback may have cancelled itself, in which case another executor may have claimed the slot
+                if (entry->token != token) {
+                    continue;
+                }
+
+                if (delay_ms == 0) {
+                    entry->token        = INVALID_DEFERRED_TOKEN;
+                    entry->trigger_time = 0;
+                    entry->callback     = NULL;
+                    entry->cb_arg       = NULL;
+                    continue;
+                }
+
+                // Relative to the previous trigger, see the comment in the table scan implementation below
+                entry->trigger_time += delay_ms;
+            }
+
+            uint16_t last = table[0].heap_count++;
+            heap_swap(table, position, last);
+            heap_fix(table, last);
+        }
+    }
+}
+
+#else // DEFERRED_EXEC_HEAP
+
 //------------------------------------
 // Helpers
 //
@@ -115,15 +355,34 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     return false;
 }
 
-void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
+uint32_t deferred_exec_advanced_next_deadline(deferred_executor_t *table, size_t table_count) {
+    uint32_t now      = timer_read32();
+    uint32_t earliest = UINT32_MAX;
+    for (int i = 0; i < table_count; ++i) {
+        deferred_executor_t *entry = &table[i];
+        if (entry->token != INVALID_DEFERRED_TOKEN) {
+            int32_t remaining = (int32_t)TIMER_DIFF_32(entry->trigger_time, now);
+            if (remaining <= 0) {
+                return 0;
+            }
+            earliest = MIN(earliest, (uint32_t)remaining);
+        }
+    }
+    return earliest;
+}
+
+void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, deferred_exec_state_t *state) {
     uint32_t now = timer_read32();
 
     // Throttle only once per millisecond
-    if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
-        *last_execution_time = now;
+    if (((int32_t)TIMER_DIFF_32(now, state->last_execution_time)) > 0) {
+        state->last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
+        // Run through each of the executors, starting where the previous run yielded so that a slow executor in a low
+        // slot can't starve the ones after it
+        size_t start = state->scan_start < table_count ? state->scan_start : 0;
+        for (size_t n = 0; n < table_count; ++n) {
+            size_t               i     = (start + n) % table_count;
             deferred_executor_t *entry = &table[i];
 
             // Check if we're supposed to execute this entry
@@ -145,27 +404,50 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
                     entry->callback     = NULL;
                     entry->cb_arg       = NULL;
                 }
+
+                // Leave any other due executors for the next run if the matrix needs servicing
+                if (task_scheduler_should_yield()) {
+                    state->scan_start = (i + 1) % table_count;
+                    break;
+                }
             }
         }
     }
 }
 
+#endif // DEFERRED_EXEC_HEAP
+
 //------------------------------------
 // Basic API: used by user-mode code, guaranteed to not collide with core deferred execution
 //
 
-static uint32_t            last_deferred_exec_check                = 0;
-static deferred_executor_t basic_executors[MAX_DEFERRED_EXECUTORS] = {0};
+static deferred_exec_state_t basic_executors_state                   = {0};
+static deferred_executor_t   basic_executors[MAX_DEFERRED_EXECUTORS] = {0};
 
 deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+#ifdef TASK_SCHEDULER_ENABLE
+    // The task sleeps until its next deadline, which may be later than this one
+    task_scheduler_wake(TASK_SCHEDULER_DEFERRED_EXEC);
+#endif
     return defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
 }
 bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
+#ifdef TASK_SCHEDULER_ENABLE
+    task_scheduler_wake(TASK_SCHEDULER_DEFERRED_EXEC);
+#endif
     return extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
 }
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+uint32_t deferred_exec_next_deadline(void) {
+    return deferred_exec_advanced_next_deadline(basic_executors, MAX_DEFERRED_EXECUTORS);
+}
 void deferred_exec_task(void) {
-    deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
+    deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &basic_executors_state);
+}
+uint32_t deferred_exec_task_interval(void) {
+    // Nothing queued sleeps until defer_exec() wakes the task up, the throttle in deferred_exec_advanced_task() keeps
+    // anything already due from running more than once per millisecond.
+    return MIN(deferred_exec_next_deadline(), UINT16_MAX);
 }
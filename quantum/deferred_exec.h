@@ -14,7 +14,11 @@
 /**
  * @typedef A token that can be used to cancel or extend an existing deferred execution.
  */
+#ifdef DEFERRED_EXEC_HEAP
+typedef uint16_t deferred_token;
+#else
 typedef uint8_t deferred_token;
+#endif
 
 /**
  * @def The constant used to denote an invalid deferred execution token.
@@ -60,11 +64,23 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Returns the number of milliseconds until the next deferred execution is due.
+ *
+ * @return 0 if an execution is already due, UINT32_MAX if nothing is queued
+ */
+uint32_t deferred_exec_next_deadline(void);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
 void deferred_exec_task(void);
 
+/**
+ * Forward declaration for the main loop in order to determine when deferred_exec_task() next needs to run. Should not be invoked by keyboard/user code.
+ */
+uint32_t deferred_exec_task_interval(void);
+
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //------------------------------------
@@ -79,8 +95,24 @@ typedef struct deferred_executor_t {
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
+#ifdef DEFERRED_EXEC_HEAP
+    uint16_t heap_slot;     // table slot queued at this heap position, XOR'ed with the position so that a zeroed table is a valid heap
+    uint16_t heap_position; // heap position of this table slot, XOR'ed with the slot
+    uint16_t heap_count;    // number of queued executors, only used in the first entry of the table
+#endif
 } deferred_executor_t;
 
+/**
+ * @struct Bookkeeping kept by deferred_exec_advanced_task() for each custom-allocated table.
+ * @brief Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate one zero-initialised instance per table.
+ */
+typedef struct deferred_exec_state_t {
+    uint32_t last_execution_time; // checked first to determine if execution is needed, and updated if execution occurred
+#ifndef DEFERRED_EXEC_HEAP
+    uint16_t scan_start; // slot the next run starts scanning at after a yield
+#endif
+} deferred_exec_state_t;
+
 /**
  * Configures the supplied deferred executor to be executed after the required number of milliseconds.
  *
@@ -110,12 +142,21 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  */
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
 
+/**
+ * Returns the number of milliseconds until the next deferred execution in the custom table is due.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @return 0 if an execution is already due, UINT32_MAX if nothing is queued
+ */
+uint32_t deferred_exec_advanced_next_deadline(deferred_executor_t *table, size_t table_count);
+
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
  *
  * @param table[in] the custom table used for storage
  * @param table_count[in] the number of available items in the table
- * @param last_execution_time[in,out] the last execution time -- this will be checked first to determine if execution is needed, and updated if execution occurred
+ * @param state[in,out] the bookkeeping for the custom table, such as the last execution time
  */
-void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time);
+void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, deferred_exec_state_t *state);
@@ -15,6 +15,7 @@
  */
 
 #include "digitizer.h"
+#include "action_util.h"
 
 digitizer_t digitizer_state = {
     .in_range = false,
@@ -27,6 +28,7 @@ digitizer_t digitizer_state = {
 
 void digitizer_flush(void) {
     if (digitizer_state.dirty) {
+        keyboard_report_batch_flush();
         host_digitizer_send(&digitizer_state);
         digitizer_state.dirty = false;
     }
@@ -98,6 +98,54 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_CACHE
+// Only the lowest layers are mirrored in RAM, the rest are read from EEPROM
+#    ifndef DYNAMIC_KEYMAP_CACHE_LAYER_COUNT
+#        define DYNAMIC_KEYMAP_CACHE_LAYER_COUNT DYNAMIC_KEYMAP_LAYER_COUNT
+#    endif
+_Static_assert(DYNAMIC_KEYMAP_CACHE_LAYER_COUNT > 0 && DYNAMIC_KEYMAP_CACHE_LAYER_COUNT <= DYNAMIC_KEYMAP_LAYER_COUNT, "DYNAMIC_KEYMAP_CACHE_LAYER_COUNT must be between 1 and DYNAMIC_KEYMAP_LAYER_COUNT");
+
+static uint16_t keymap_cache[DYNAMIC_KEYMAP_CACHE_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+#    if defined(ENCODER_MAP_ENABLE) && NUM_ENCODERS > 0
+static uint16_t encoder_cache[DYNAMIC_KEYMAP_CACHE_LAYER_COUNT][NUM_ENCODERS][2];
+#    endif
+static bool cache_loaded = false;
+
+// Reads `count` big endian keycodes from EEPROM into native ones in RAM
+static void cache_read_keycodes(uint16_t *cache, const void *address, uint16_t count) {
+    eeprom_read_block(cache, address, count * 2);
+    const uint8_t *bytes = (const uint8_t *)cache;
+    for (uint16_t i = 0; i < count; i++) {
+        cache[i] = (bytes[i * 2] << 8) | bytes[i * 2 + 1];
+    }
+}
+
+static inline void dynamic_keymap_cache_load(void) {
+    if (cache_loaded) {
+        return;
+    }
+    // Layers are stored back to back, so the cached ones are a single block
+    cache_read_keycodes(&keymap_cache[0][0][0], (const void *)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_CACHE_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS);
+#    if defined(ENCODER_MAP_ENABLE) && NUM_ENCODERS > 0
+    cache_read_keycodes(&encoder_cache[0][0][0], (const void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR, DYNAMIC_KEYMAP_CACHE_LAYER_COUNT * NUM_ENCODERS * 2);
+#    endif
+    cache_loaded = true;
+}
+
+// Applies one byte written at `offset` of the keymap EEPROM buffer to the cache
+static void dynamic_keymap_cache_update_byte(uint16_t offset, uint8_t value) {
+    uint16_t index = offset / 2;
+    if (index < DYNAMIC_KEYMAP_CACHE_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS) {
+        uint16_t *keycode = &keymap_cache[0][0][0] + index;
+        if (offset & 1) {
+            *keycode = (*keycode & 0xFF00) | value;
+        } else {
+            *keycode = (*keycode & 0x00FF) | (value << 8);
+        }
+    }
+}
+#endif // DYNAMIC_KEYMAP_CACHE
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -109,6 +157,12 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_CACHE
+    if (layer < DYNAMIC_KEYMAP_CACHE_LAYER_COUNT) {
+        dynamic_keymap_cache_load();
+        return keymap_cache[layer][row][column];
+    }
+#endif
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
@@ -122,6 +176,12 @@ void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#ifdef DYNAMIC_KEYMAP_CACHE
+    if (layer < DYNAMIC_KEYMAP_CACHE_LAYER_COUNT) {
+        keymap_cache[layer][row][column] = keycode;
+    }
+#endif
+    layer_lookup_cache_clear();
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -131,6 +191,12 @@ void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id
 
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+#    ifdef DYNAMIC_KEYMAP_CACHE
+    if (layer < DYNAMIC_KEYMAP_CACHE_LAYER_COUNT) {
+        dynamic_keymap_cache_load();
+        return encoder_cache[layer][encoder_id][clockwise ? 0 : 1];
+    }
+#    endif
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
@@ -144,6 +210,11 @@ void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwis
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+#    ifdef DYNAMIC_KEYMAP_CACHE
+    if (layer < DYNAMIC_KEYMAP_CACHE_LAYER_COUNT) {
+        encoder_cache[layer][encoder_id][clockwise ? 0 : 1] = keycode;
+    }
+#    endif
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -175,7 +246,7 @@ void dynamic_keymap_reset(void) {
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   source                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
@@ -190,15 +261,19 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   target                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
             eeprom_update_byte(target, *source);
+#ifdef DYNAMIC_KEYMAP_CACHE
+            dynamic_keymap_cache_update_byte(offset + i, *source);
+#endif
         }
         source++;
         target++;
     }
+    layer_lookup_cache_clear();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -226,7 +301,7 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -240,7 +315,7 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -18,6 +18,7 @@
 
 #include "analog.h"
 #include "wait.h"
+#include "action_util.h"
 
 joystick_t joystick_state = {
     .buttons = {0},
@@ -39,6 +40,7 @@ __attribute__((weak)) void joystick_task(void) {
 
 void joystick_flush(void) {
     if (joystick_state.dirty) {
+        keyboard_report_batch_flush();
         host_joystick_send(&joystick_state);
         joystick_state.dirty = false;
     }
@@ -33,6 +33,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "task_profiler.h"
+#include "task_scheduler.h"
+#include "timeout.h"
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
 #endif
@@ -502,6 +505,9 @@ static bool matrix_task(void) {
 
     const bool process_keypress = should_process_keypress();
 
+    // Send all changes of this scan to the host as one report where possible
+    keyboard_report_batch_begin();
+
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         const matrix_row_t current_row = matrix_get_row(row);
         const matrix_row_t row_changes = current_row ^ matrix_previous[row];
@@ -526,6 +532,8 @@ static bool matrix_task(void) {
         matrix_previous[row] = current_row;
     }
 
+    keyboard_report_batch_end();
+
     return matrix_changed;
 }
 
@@ -563,26 +571,13 @@ void quantum_task(void) {
     music_task();
 #endif
 
-#ifdef KEY_OVERRIDE_ENABLE
-    key_override_task();
-#endif
+    // Tap dance, combo, leader, auto shift, Caps Word and key override timeouts
+    timeout_task();
 
 #ifdef SEQUENCER_ENABLE
     sequencer_task();
 #endif
 
-#ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
-#endif
-
-#ifdef COMBO_ENABLE
-    combo_task();
-#endif
-
-#ifdef LEADER_ENABLE
-    leader_task();
-#endif
-
 #ifdef WPM_ENABLE
     decay_wpm();
 #endif
@@ -595,106 +590,147 @@ void quantum_task(void) {
     dip_switch_read(false);
 #endif
 
-#ifdef AUTO_SHIFT_ENABLE
-    autoshift_matrix_scan();
+#ifdef SECURE_ENABLE
+    secure_task();
 #endif
+}
 
-#ifdef CAPS_WORD_ENABLE
-    caps_word_task();
-#endif
+/** \brief Runs every stage of the main task, each wrapped for the task profiler. */
+static bool keyboard_matrix_stage(void) {
+    bool matrix_changed = false;
 
-#ifdef SECURE_ENABLE
-    secure_task();
+    TASK_PROFILE(TASK_PROFILER_MATRIX_TASK, {
+        if (matrix_task()) {
+            last_matrix_activity_trigger();
+            matrix_changed = true;
+#ifdef TASK_SCHEDULER_ENABLE
+            task_scheduler_wake(TASK_SCHEDULER_QUANTUM);
 #endif
+        }
+    });
+#ifdef TASK_SCHEDULER_ENABLE
+    task_scheduler_matrix_scanned();
+#endif
+
+    return matrix_changed;
 }
 
-/** \brief Main task that is repeatedly called as fast as possible. */
-void keyboard_task(void) {
+#ifdef TASK_SCHEDULER_ENABLE
+bool task_scheduler_service_matrix(void) {
+    return keyboard_matrix_stage();
+}
+#endif
+
+static void keyboard_task_stages(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
-        last_matrix_activity_trigger();
+#ifdef TASK_SCHEDULER_ENABLE
+    // Matrix changes found in between the tasks of the previous iteration, after the displays had been checked
+    if (task_scheduler_matrix_changed()) {
+        activity_has_occurred = true;
+    }
+    task_scheduler_begin();
+#endif
+
+    if (keyboard_matrix_stage()) {
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_QUANTUM, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_QUANTUM_TASK, quantum_task()));
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
-    split_watchdog_task();
+    TASK_PROFILE(TASK_PROFILER_SPLIT_WATCHDOG_TASK, split_watchdog_task());
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_RGBLIGHT, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_RGBLIGHT_TASK, rgblight_task()));
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_LED_MATRIX, led_matrix_task_interval(), TASK_PROFILE(TASK_PROFILER_LED_MATRIX_TASK, led_matrix_task()));
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_RGB_MATRIX, rgb_matrix_task_interval(), TASK_PROFILE(TASK_PROFILER_RGB_MATRIX_TASK, rgb_matrix_task()));
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
-    backlight_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_BACKLIGHT, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_BACKLIGHT_TASK, backlight_task()));
 #    endif
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_read()) {
-        last_encoder_activity_trigger();
-        activity_has_occurred = true;
-    }
+    TASK_PROFILE(TASK_PROFILER_ENCODER_READ, {
+        if (encoder_read()) {
+            last_encoder_activity_trigger();
+            activity_has_occurred = true;
+        }
+    });
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
-        last_pointing_device_activity_trigger();
-        activity_has_occurred = true;
-    }
+    TASK_SCHEDULE(TASK_SCHEDULER_POINTING_DEVICE, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_POINTING_DEVICE_TASK, {
+                      if (pointing_device_task()) {
+                          last_pointing_device_activity_trigger();
+                          activity_has_occurred = true;
+                      }
+                  }));
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_OLED, oled_task_interval(), TASK_PROFILE(TASK_PROFILER_OLED_TASK, oled_task()));
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
+#        ifdef TASK_SCHEDULER_ENABLE
+    if (task_scheduler_matrix_changed()) activity_has_occurred = true;
+#        endif
     if (activity_has_occurred) oled_on();
 #    endif
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_ST7565, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_ST7565_TASK, st7565_task()));
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
+#        ifdef TASK_SCHEDULER_ENABLE
+    if (task_scheduler_matrix_changed()) activity_has_occurred = true;
+#        endif
     if (activity_has_occurred) st7565_on();
 #    endif
 #endif
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
-    mousekey_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_MOUSEKEY, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_MOUSEKEY_TASK, mousekey_task()));
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_PS2_MOUSE, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_PS2_MOUSE_TASK, ps2_mouse_task()));
 #endif
 
 #ifdef MIDI_ENABLE
-    midi_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_MIDI, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_MIDI_TASK, midi_task()));
 #endif
 
 #ifdef VELOCIKEY_ENABLE
-    if (velocikey_enabled()) {
-        velocikey_decelerate();
-    }
+    TASK_SCHEDULE(TASK_SCHEDULER_VELOCIKEY, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_VELOCIKEY_TASK, {
+                      if (velocikey_enabled()) {
+                          velocikey_decelerate();
+                      }
+                  }));
 #endif
 
 #ifdef JOYSTICK_ENABLE
-    joystick_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_JOYSTICK, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_JOYSTICK_TASK, joystick_task()));
 #endif
 
 #ifdef BLUETOOTH_ENABLE
-    bluetooth_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_BLUETOOTH, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_BLUETOOTH_TASK, bluetooth_task()));
 #endif
 
-    led_task();
+    TASK_SCHEDULE(TASK_SCHEDULER_LED, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_LED_TASK, led_task()));
+}
+
+/** \brief Main task that is repeatedly called as fast as possible. */
+void keyboard_task(void) {
+    TASK_PROFILE(TASK_PROFILER_KEYBOARD_TASK, keyboard_task_stages());
 }
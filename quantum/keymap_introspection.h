@@ -55,3 +55,24 @@ combo_t* combo_get_raw(uint16_t combo_idx);
 combo_t* combo_get(uint16_t combo_idx);
 
 #endif // defined(COMBO_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader sequences
+
+#if defined(LEADER_ENABLE) && defined(LEADER_SEQUENCE_TABLE)
+
+// Forward declaration of leader_sequence_t so we don't need to deal with header reordering
+struct leader_sequence_t;
+typedef struct leader_sequence_t leader_sequence_t;
+
+// Get the number of leader sequences defined in the user's keymap, stored in firmware rather than any other persistent storage
+uint16_t leader_sequence_count_raw(void);
+// Get the number of leader sequences defined in the user's keymap, potentially stored dynamically
+uint16_t leader_sequence_count(void);
+
+// Get the leader sequence at the given index, stored in firmware rather than any other persistent storage
+const leader_sequence_t* leader_sequence_get_raw(uint16_t sequence_idx);
+// Get the leader sequence at the given index, potentially stored dynamically
+const leader_sequence_t* leader_sequence_get(uint16_t sequence_idx);
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_SEQUENCE_TABLE)
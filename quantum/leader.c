@@ -3,10 +3,16 @@
 
 #include "leader.h"
 #include "timer.h"
+#include "timeout.h"
 #include "util.h"
 
 #include <string.h>
 
+#ifdef LEADER_SEQUENCE_TABLE
+#    include <stdlib.h>
+#    include "keymap_introspection.h"
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
@@ -17,6 +23,89 @@ uint16_t leader_time          = 0;
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+#ifdef LEADER_SEQUENCE_TABLE
+// Positions in leader_sequences, sorted by their keys. This is a trie laid out flat: the entries that start with the keys typed so far form a contiguous range, which every key narrows down
+static uint16_t *leader_table_index = NULL;
+static bool      leader_table_built = false;
+// The range of leader_table_index that matches the sequence buffer
+static uint16_t leader_match_start = 0;
+static uint16_t leader_match_end   = 0;
+
+static int leader_table_compare(const void *a, const void *b) {
+    const uint16_t           index_a    = *(const uint16_t *)a;
+    const uint16_t           index_b    = *(const uint16_t *)b;
+    const leader_sequence_t *sequence_a = leader_sequence_get(index_a);
+    const leader_sequence_t *sequence_b = leader_sequence_get(index_b);
+    for (uint8_t i = 0; i < ARRAY_SIZE(sequence_a->keys); i++) {
+        if (sequence_a->keys[i] != sequence_b->keys[i]) {
+            return sequence_a->keys[i] < sequence_b->keys[i] ? -1 : 1;
+        }
+    }
+    // Of identical entries, the first one in the table wins
+    return (index_a > index_b) - (index_a < index_b);
+}
+
+/** Builds the index on first use, and makes every entry a candidate again. */
+static void leader_table_start(void) {
+    if (!leader_table_built) {
+        leader_table_built = true;
+
+        uint16_t count = leader_sequence_count();
+        if (count > 0 && (leader_table_index = malloc(count * sizeof(uint16_t)))) {
+            for (uint16_t i = 0; i < count; i++) {
+                leader_table_index[i] = i;
+            }
+            qsort(leader_table_index, count, sizeof(uint16_t), leader_table_compare);
+        }
+    }
+
+    leader_match_start = 0;
+    leader_match_end   = leader_table_index ? leader_sequence_count() : 0;
+}
+
+static uint16_t leader_table_key(uint16_t position, uint8_t depth) {
+    return leader_sequence_get(leader_table_index[position])->keys[depth];
+}
+
+/** Narrows the candidates down to the entries with `keycode` at `depth`, with a binary search for either end of the range. */
+static void leader_table_add(uint8_t depth, uint16_t keycode) {
+    uint16_t low = leader_match_start, high = leader_match_end;
+    while (low < high) {
+        uint16_t middle = low + (high - low) / 2;
+        if (leader_table_key(middle, depth) < keycode) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    leader_match_start = low;
+
+    high = leader_match_end;
+    while (low < high) {
+        uint16_t middle = low + (high - low) / 2;
+        if (leader_table_key(middle, depth) <= keycode) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    leader_match_end = low;
+}
+
+/** Returns the entry that matches the sequence buffer exactly, or NULL. Shorter entries are padded with zeros, so it sorts first among the candidates. */
+static const leader_sequence_t *leader_table_match(void) {
+    if (leader_sequence_size == 0 || leader_match_start >= leader_match_end) {
+        return NULL;
+    }
+
+    const leader_sequence_t *sequence = leader_sequence_get(leader_table_index[leader_match_start]);
+    if (leader_sequence_size < ARRAY_SIZE(sequence->keys) && sequence->keys[leader_sequence_size] != 0) {
+        return NULL;
+    }
+    return sequence;
+}
+#endif
+
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
@@ -29,11 +118,24 @@ void leader_start(void) {
     leading              = true;
     leader_time          = timer_read();
     leader_sequence_size = 0;
+#if !defined(LEADER_NO_TIMEOUT)
+    timeout_start(TIMEOUT_LEADER, LEADER_TIMEOUT + 1, leader_task);
+#endif
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#ifdef LEADER_SEQUENCE_TABLE
+    leader_table_start();
+#endif
 }
 
 void leader_end(void) {
     leading = false;
+    timeout_cancel(TIMEOUT_LEADER);
+#ifdef LEADER_SEQUENCE_TABLE
+    const leader_sequence_t *sequence = leader_table_match();
+    if (sequence != NULL && sequence->action != NULL) {
+        sequence->action();
+    }
+#endif
     leader_end_user();
 }
 
@@ -59,11 +161,22 @@ bool leader_sequence_add(uint16_t keycode) {
 #endif
 
     leader_sequence[leader_sequence_size] = keycode;
+#ifdef LEADER_SEQUENCE_TABLE
+    leader_table_add(leader_sequence_size, keycode);
+#endif
     leader_sequence_size++;
 
     return true;
 }
 
+bool leader_sequence_complete(void) {
+#if defined(LEADER_SEQUENCE_TABLE) && defined(LEADER_SEQUENCE_TABLE_EARLY_END)
+    return leader_match_end - leader_match_start == 1 && leader_table_match() != NULL;
+#else
+    return false;
+#endif
+}
+
 bool leader_sequence_timed_out(void) {
 #if defined(LEADER_NO_TIMEOUT)
     return leader_sequence_size > 0 && timer_elapsed(leader_time) > LEADER_TIMEOUT;
@@ -74,6 +187,7 @@ bool leader_sequence_timed_out(void) {
 
 void leader_reset_timer(void) {
     leader_time = timer_read();
+    timeout_start(TIMEOUT_LEADER, LEADER_TIMEOUT + 1, leader_task);
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
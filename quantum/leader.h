@@ -1,6 +1,8 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#pragma once
+
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -11,6 +13,22 @@
  * \{
  */
 
+/**
+ * \brief An entry of the `leader_sequences` table, see `LEADER_SEQUENCE()`.
+ */
+typedef struct leader_sequence_t {
+    uint16_t keys[5];
+    void (*action)(void);
+} leader_sequence_t;
+
+/**
+ * \brief Declare a table entry that calls `action` when the given keycodes, up to five, are typed after the leader key.
+ *
+ * Requires `LEADER_SEQUENCE_TABLE` to be defined.
+ */
+#define LEADER_SEQUENCE(action_, ...) \
+    { .keys = {__VA_ARGS__}, .action = (action_) }
+
 /**
  * \brief User callback, invoked when the leader sequence begins.
  */
@@ -61,6 +79,13 @@ bool leader_sequence_timed_out(void);
  */
 void leader_reset_timer(void);
 
+/**
+ * Whether the sequence buffer matches an entry of the `leader_sequences` table that no other entry starts with, so that the sequence can end without waiting for the timeout.
+ *
+ * Always `false` unless both `LEADER_SEQUENCE_TABLE` and `LEADER_SEQUENCE_TABLE_EARLY_END` are defined.
+ */
+bool leader_sequence_complete(void);
+
 /**
  * Check the sequence buffer for the given keycode.
  *
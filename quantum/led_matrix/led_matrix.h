@@ -117,6 +117,9 @@ void process_led_matrix(uint8_t row, uint8_t col, bool pressed);
 
 void led_matrix_task(void);
 
+// Milliseconds until led_matrix_task() next has work to do
+uint32_t led_matrix_task_interval(void);
+
 // This runs after another backlight effect and replaces
 // values already set
 void led_matrix_indicators(void);
@@ -15,6 +15,8 @@
  */
 
 #include "keyboard.h"
+#include "task_profiler.h"
+#include "task_scheduler.h"
 
 void platform_setup(void);
 
@@ -57,20 +59,25 @@ int main(void) {
 
     /* Main loop */
     while (true) {
-        protocol_task();
+        TASK_PROFILE(TASK_PROFILER_PROTOCOL_TASK, protocol_task());
 
 #ifdef QUANTUM_PAINTER_ENABLE
         // Run Quantum Painter task
         void qp_internal_task(void);
-        qp_internal_task();
+        TASK_SCHEDULE(TASK_SCHEDULER_QUANTUM_PAINTER, TASK_SCHEDULER_DEFAULT_INTERVAL, TASK_PROFILE(TASK_PROFILER_QUANTUM_PAINTER_TASK, qp_internal_task()));
 #endif
 
 #ifdef DEFERRED_EXEC_ENABLE
         // Run deferred executions
-        void deferred_exec_task(void);
-        deferred_exec_task();
+        void     deferred_exec_task(void);
+        uint32_t deferred_exec_task_interval(void);
+        TASK_SCHEDULE(TASK_SCHEDULER_DEFERRED_EXEC, deferred_exec_task_interval(), TASK_PROFILE(TASK_PROFILER_DEFERRED_EXEC_TASK, deferred_exec_task()));
 #endif // DEFERRED_EXEC_ENABLE
 
-        housekeeping_task();
+        TASK_PROFILE(TASK_PROFILER_HOUSEKEEPING_TASK, housekeeping_task());
+
+#ifdef TASK_PROFILER_ENABLE
+        task_profiler_task();
+#endif
     }
 }
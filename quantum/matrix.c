@@ -21,6 +21,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "quantum.h"
+#include "matrix_port.h"
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
@@ -61,6 +62,11 @@ static SPLIT_MUTABLE_COL pin_t col_pins[MATRIX_COLS]   = MATRIX_COL_PINS;
 #    endif // MATRIX_COL_PINS
 #endif
 
+// read the columns of a COL2ROW matrix one port at a time
+#if defined(MATRIX_PORT_READ) && !defined(DIRECT_PINS) && defined(DIODE_DIRECTION) && defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS) && (DIODE_DIRECTION == COL2ROW)
+#    define MATRIX_COL_PORT_READ
+#endif
+
 /* matrix state(1:on, 0:off) */
 extern matrix_row_t raw_matrix[MATRIX_ROWS]; // raw values
 extern matrix_row_t matrix[MATRIX_ROWS];     // debounced values
@@ -180,6 +186,10 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_COL_PORT_READ
+    // Read all cols, one port at a time
+    current_row_value = matrix_port_read();
+#            else
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
@@ -188,6 +198,7 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
         // Populate the matrix row with the state of the col pin
         current_row_value |= pin_state ? 0 : row_shifter;
     }
+#            endif
 
     // Unselect row
     unselect_row(current_row);
@@ -301,6 +312,9 @@ void matrix_init(void) {
 
     // initialize key pins
     matrix_init_pins();
+#ifdef MATRIX_COL_PORT_READ
+    matrix_port_init(col_pins, MATRIX_COLS);
+#endif
 
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
@@ -0,0 +1,91 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+#include "matrix_port.h"
+
+#ifdef MATRIX_PORT_READ
+
+typedef struct matrix_port_run_t {
+    matrix_row_t mask;  // width of the run, aligned to bit 0
+    uint8_t      port;  // index into port_pins
+    uint8_t      shift; // first bit of the run within the port
+    uint8_t      col;   // first column of the run
+} matrix_port_run_t;
+
+// One pin per port, used to address the port when reading it
+static pin_t             port_pins[MATRIX_COLS];
+static uint8_t           port_count = 0;
+// Runs are stored grouped by port, so that every port is read once
+static matrix_port_run_t runs[MATRIX_COLS];
+static uint8_t           run_count = 0;
+
+static uint8_t find_port(pin_t pin) {
+    for (uint8_t i = 0; i < port_count; i++) {
+        if (getPinPort(port_pins[i]) == getPinPort(pin)) {
+            return i;
+        }
+    }
+    port_pins[port_count] = pin;
+    return port_count++;
+}
+
+void matrix_port_init(const pin_t *pins, uint8_t count) {
+    port_count = 0;
+    run_count  = 0;
+
+    // Assign ports in order of their first column
+    for (uint8_t col = 0; col < count; col++) {
+        if (pins[col] != NO_PIN) {
+            find_port(pins[col]);
+        }
+    }
+
+    for (uint8_t port = 0; port < port_count; port++) {
+        matrix_port_run_t *run   = NULL;
+        uint8_t            width = 0;
+        for (uint8_t col = 0; col < count; col++) {
+            pin_t pin = pins[col];
+            if (pin == NO_PIN || getPinPort(pin) != getPinPort(port_pins[port])) {
+                continue;
+            }
+
+            uint8_t pad = getPinPad(pin);
+            if (run && col == run->col + width && pad == run->shift + width) {
+                // Neighbouring bit on the neighbouring column, extend the run
+                run->mask = (run->mask << 1) | 1;
+            } else {
+                run   = &runs[run_count++];
+                *run  = (matrix_port_run_t){.mask = 1, .port = port, .shift = pad, .col = col};
+                width = 0;
+            }
+            width++;
+        }
+    }
+}
+
+matrix_row_t matrix_port_read(void) {
+    matrix_row_t row   = 0;
+    port_data_t  value = 0;
+    uint8_t      port  = UINT8_MAX;
+
+    for (uint8_t i = 0; i < run_count; i++) {
+        const matrix_port_run_t *run = &runs[i];
+        if (run->port != port) {
+            port  = run->port;
+            value = readPinPort(port_pins[port]);
+        }
+#    if MATRIX_INPUT_PRESSED_STATE == 0
+        row |= (~(matrix_row_t)(value >> run->shift) & run->mask) << run->col;
+#    else
+        row |= ((matrix_row_t)(value >> run->shift) & run->mask) << run->col;
+#    endif
+    }
+    return row;
+}
+
+uint8_t matrix_port_count(void) {
+    return port_count;
+}
+
+#endif // MATRIX_PORT_READ
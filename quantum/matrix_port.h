@@ -0,0 +1,47 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+
+/*
+    Whole-port reads of the matrix columns.
+
+    Reading the columns of a COL2ROW matrix pin by pin costs one GPIO read per
+    column for every row. Column pins are usually wired to a handful of ports,
+    often in runs of neighbouring bits, so matrix_port_init() groups the pins by
+    port once and splits every port into runs of consecutive bits that map to
+    consecutive columns. matrix_port_read() then reads each port a single time
+    and moves every run into the row value with one shift and one mask.
+
+    The platform provides three primitives alongside readPin():
+
+        readPinPort(pin)  the input register of the port that holds `pin`
+        getPinPort(pin)   a value identifying that port, comparable with ==
+        getPinPad(pin)    the bit of `pin` within its port
+*/
+
+#ifndef MATRIX_INPUT_PRESSED_STATE
+#    define MATRIX_INPUT_PRESSED_STATE 0
+#endif
+
+#if defined(readPinPort) && !defined(MATRIX_DISABLE_PORT_READ)
+#    define MATRIX_PORT_READ
+#endif
+
+/**
+ * @brief Groups the given column pins by port, NO_PIN columns are never reported as pressed.
+ */
+void matrix_port_init(const pin_t *pins, uint8_t count);
+
+/**
+ * @brief Reads all column pins with one read per port and returns the pressed columns as a row value.
+ */
+matrix_row_t matrix_port_read(void);
+
+/**
+ * @brief Returns the number of port reads performed by matrix_port_read().
+ */
+uint8_t matrix_port_count(void);
@@ -0,0 +1,98 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <vector>
+
+extern "C" {
+#include "matrix_port.h"
+#include "matrix_port/tests/mock.h"
+}
+
+class MatrixPortTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        for (uint8_t i = 0; i < MOCK_PORTS; i++) {
+            mock_ports[i] = 0xFFFF;
+        }
+        mock_port_reads = 0;
+    }
+
+    // The pin by pin read of matrix.c
+    matrix_row_t read_per_pin(const std::vector<pin_t> &pins) {
+        matrix_row_t row = 0;
+        for (uint8_t col = 0; col < pins.size(); col++) {
+            if (pins[col] != NO_PIN && readPin(pins[col]) == MATRIX_INPUT_PRESSED_STATE) {
+                row |= MATRIX_ROW_SHIFTER << col;
+            }
+        }
+        return row;
+    }
+
+    // Drives the ports through a fixed pseudo random sequence and compares both paths
+    void expect_same_as_per_pin(const std::vector<pin_t> &pins, uint16_t rounds) {
+        matrix_port_init(pins.data(), pins.size());
+
+        uint32_t seed = 0x2545F491;
+        for (uint16_t round = 0; round < rounds; round++) {
+            for (uint8_t i = 0; i < MOCK_PORTS; i++) {
+                seed          = seed * 1664525 + 1013904223;
+                mock_ports[i] = seed >> 16;
+            }
+            ASSERT_EQ(matrix_port_read(), read_per_pin(pins)) << "round " << round;
+        }
+    }
+};
+
+TEST_F(MatrixPortTest, ContiguousColumnsAreOnePort) {
+    std::vector<pin_t> pins = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    matrix_port_init(pins.data(), pins.size());
+    EXPECT_EQ(matrix_port_count(), 1);
+
+    // Every state of the eight columns
+    for (uint16_t state = 0; state < 0x100; state++) {
+        mock_ports[0] = 0xFF00 | state;
+        ASSERT_EQ(matrix_port_read(), read_per_pin(pins));
+    }
+}
+
+TEST_F(MatrixPortTest, OneReadPerPort) {
+    std::vector<pin_t> pins = {0x10, 0x32, 0x11, 0x33, 0x05, 0x12, 0x34, 0x06};
+    matrix_port_init(pins.data(), pins.size());
+    EXPECT_EQ(matrix_port_count(), 3);
+
+    matrix_port_read();
+    EXPECT_EQ(mock_port_reads, 3);
+}
+
+TEST_F(MatrixPortTest, ShiftedRun) {
+    expect_same_as_per_pin({0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F}, 200);
+}
+
+TEST_F(MatrixPortTest, ReversedPins) {
+    expect_same_as_per_pin({0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00}, 200);
+}
+
+TEST_F(MatrixPortTest, InterleavedPorts) {
+    expect_same_as_per_pin({0x00, 0x10, 0x01, 0x11, 0x02, 0x12, 0x03, 0x13, 0x20, 0x21, 0x22, 0x30, 0x3F, 0x08, 0x09, 0x0A}, 500);
+}
+
+TEST_F(MatrixPortTest, NoPinColumns) {
+    std::vector<pin_t> pins = {0x00, NO_PIN, 0x02, 0x03, NO_PIN, 0x15};
+    expect_same_as_per_pin(pins, 200);
+
+    // Grounding every input must not report the unconnected columns
+    for (uint8_t i = 0; i < MOCK_PORTS; i++) {
+        mock_ports[i] = 0;
+    }
+    EXPECT_EQ(matrix_port_read(), 0b101101);
+}
+
+TEST_F(MatrixPortTest, FullRow) {
+    expect_same_as_per_pin({0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F}, 200);
+
+    for (uint8_t i = 0; i < MOCK_PORTS; i++) {
+        mock_ports[i] = 0;
+    }
+    EXPECT_EQ(matrix_port_read(), 0xFFFF);
+}
@@ -0,0 +1,12 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "mock.h"
+
+port_data_t mock_ports[MOCK_PORTS] = {0};
+uint32_t    mock_port_reads        = 0;
+
+port_data_t mockReadPort(pin_t pin) {
+    mock_port_reads++;
+    return mock_ports[getPinPort(pin)];
+}
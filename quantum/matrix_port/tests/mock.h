@@ -0,0 +1,22 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Four mocked 16 bit ports, pin 0x23 is bit 3 of port 2. */
+#define MOCK_PORTS 4
+
+typedef uint8_t  pin_t;
+typedef uint16_t port_data_t;
+
+extern port_data_t mock_ports[MOCK_PORTS];
+extern uint32_t    mock_port_reads;
+
+#define readPin(pin) ((bool)(mock_ports[getPinPort(pin)] & (1 << getPinPad(pin))))
+#define readPinPort(pin) (mockReadPort(pin))
+#define getPinPort(pin) ((pin) >> 4)
+#define getPinPad(pin) ((pin)&0xF)
+
+port_data_t mockReadPort(pin_t pin);
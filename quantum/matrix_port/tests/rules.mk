@@ -0,0 +1,10 @@
+# Copyright 2023 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+matrix_port_DEFS := -DMATRIX_ROWS=1 -DMATRIX_COLS=16
+matrix_port_CONFIG := $(QUANTUM_PATH)/matrix_port/tests/config_mock.h
+
+matrix_port_SRC := \
+	$(QUANTUM_PATH)/matrix_port/tests/mock.c \
+	$(QUANTUM_PATH)/matrix_port/tests/matrix_port_tests.cpp \
+	$(QUANTUM_PATH)/matrix_port.c
@@ -19,6 +19,7 @@
 #include <string.h>
 #include "keycode.h"
 #include "host.h"
+#include "action_util.h"
 #include "timer.h"
 #include "print.h"
 #include "debug.h"
@@ -608,6 +609,7 @@ void mousekey_send(void) {
     uint16_t time = timer_read();
     if (mouse_report.x || mouse_report.y) last_timer_c = time;
     if (mouse_report.v || mouse_report.h) last_timer_w = time;
+    keyboard_report_batch_flush();
     host_mouse_send(&mouse_report);
 }
 
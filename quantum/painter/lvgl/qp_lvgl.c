@@ -142,6 +142,6 @@ void qp_lvgl_detach(void) {
 // Quantum Painter LVGL Integration Internal: qp_lvgl_internal_tick
 
 void qp_lvgl_internal_tick(void) {
-    static uint32_t last_lvgl_exec = 0;
-    deferred_exec_advanced_task(lvgl_executors, 2, &last_lvgl_exec);
+    static deferred_exec_state_t lvgl_exec_state = {0};
+    deferred_exec_advanced_task(lvgl_executors, 2, &lvgl_exec_state);
 }
@@ -415,6 +415,6 @@ void qp_stop_animation(deferred_token anim_token) {
 // Quantum Painter Core API: qp_internal_animation_tick
 
 void qp_internal_animation_tick(void) {
-    static uint32_t last_anim_exec = 0;
-    deferred_exec_advanced_task(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, &last_anim_exec);
+    static deferred_exec_state_t anim_exec_state = {0};
+    deferred_exec_advanced_task(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, &anim_exec_state);
 }
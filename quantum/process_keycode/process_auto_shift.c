@@ -139,6 +139,21 @@ static void autoshift_flush_shift(void) {
     send_keyboard_report();
 }
 
+/** \brief Arms the timeout that shifts the key in progress once it has been held for long enough */
+static void autoshift_start_timeout(void) {
+    // clang-format off
+    const uint16_t timeout =
+#    ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
+        get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord)
+#    else
+        autoshift_timeout
+#    endif
+    ;
+    // clang-format on
+    const uint16_t elapsed = TIMER_DIFF_16(timer_read(), autoshift_time);
+    timeout_start(TIMEOUT_AUTO_SHIFT, elapsed >= timeout ? 0 : timeout - elapsed, autoshift_matrix_scan);
+}
+
 /** \brief Record the press of an autoshiftable key
  *
  *  \return Whether the record should be further processed.
@@ -215,6 +230,7 @@ static bool autoshift_press(uint16_t keycode, uint16_t now, keyrecord_t *record)
     autoshift_lastkey           = keycode;
     autoshift_time              = now;
     autoshift_flags.in_progress = true;
+    autoshift_start_timeout();
 
 #    if !defined(NO_ACTION_ONESHOT) && !defined(NO_ACTION_TAPPING)
     clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
@@ -235,6 +251,7 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
     if (autoshift_flags.in_progress && (keycode == autoshift_lastkey || keycode == KC_NO)) {
         // Process the auto-shiftable key.
         autoshift_flags.in_progress = false;
+        timeout_cancel(TIMEOUT_AUTO_SHIFT);
         // clang-format off
         autoshift_flags.lastshifted =
             autoshift_flags.lastshifted
@@ -273,6 +290,7 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
 #    endif
         // clang-format on
 #    if TAP_CODE_DELAY > 0
+        keyboard_report_batch_flush();
         wait_ms(TAP_CODE_DELAY);
 #    endif
 
@@ -294,7 +312,7 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
 
 /** \brief Simulates auto-shifted key releases when timeout is hit
  *
- *  Can be called from \c matrix_scan_user so that auto-shifted keys are sent
+ *  Called by the timeout service so that auto-shifted keys are sent
  *  immediately after the timeout has expired, rather than waiting for the key
  *  to be released.
  */
@@ -164,6 +164,103 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+#ifdef AUTOCORRECT_DOUBLE_ARRAY_SIZE
+/**
+ * @brief Maps a keycode in the typo buffer to its label in the double-array trie, see TYPO_SYMBOLS in the generator
+ */
+static uint8_t autocorrect_symbol(uint8_t keycode) {
+    switch (keycode) {
+        case KC_A ... KC_Z:
+            return keycode - KC_A + 1;
+        case KC_QUOTE:
+            return 27;
+        default: // KC_SPC
+            return 28;
+    }
+}
+
+static uint32_t autocorrect_read_base(uint32_t state) {
+    if (sizeof(autocorrect_base[0]) == sizeof(uint32_t)) {
+        return pgm_read_dword(autocorrect_base + state);
+    }
+    return pgm_read_word(autocorrect_base + state);
+}
+
+/**
+ * @brief Looks up the end of the typo buffer in the double-array trie. Each key is a single transition, whatever the number of siblings.
+ *
+ * @return pointer to PROGMEM correction data, or NULL if no typo was found
+ */
+static const uint8_t *autocorrect_find_typo(void) {
+    uint32_t state = 0;
+    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
+        uint8_t const  symbol = autocorrect_symbol(typo_buffer[i]);
+        uint32_t const next   = autocorrect_read_base(state) + symbol;
+        if (next >= AUTOCORRECT_DOUBLE_ARRAY_SIZE || pgm_read_byte(autocorrect_check + next) != symbol) {
+            return NULL;
+        }
+        state = next;
+
+        uint32_t const base = autocorrect_read_base(state);
+        if (base & AUTOCORRECT_LEAF) {
+            // The rest of the typo is stored with its correction, since nothing else shares it
+            const uint8_t *entry  = autocorrect_corrections + (base & ~AUTOCORRECT_LEAF);
+            uint8_t const  length = pgm_read_byte(entry++);
+            if (length > i) {
+                return NULL;
+            }
+            for (uint8_t j = 0; j < length; ++j) {
+                if (pgm_read_byte(entry + j) != autocorrect_symbol(typo_buffer[i - 1 - j])) {
+                    return NULL;
+                }
+            }
+            return entry + length;
+        }
+    }
+    return NULL;
+}
+#else
+/**
+ * @brief Looks up the end of the typo buffer in the trie stored in `autocorrect_data`
+ *
+ * @return pointer to PROGMEM correction data, or NULL if no typo was found
+ */
+static const uint8_t *autocorrect_find_typo(void) {
+    uint16_t state = 0;
+    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
+    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
+        uint8_t const key_i = typo_buffer[i];
+
+        if (code & 64) { // Check for match in node with multiple children.
+            code &= 63;
+            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+                if (!code) return NULL;
+            }
+            // Follow link to child node.
+            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
+            // Check for match in node with single child.
+        } else if (code != key_i) {
+            return NULL;
+        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
+            ++state;
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= DICTIONARY_SIZE) {
+            return NULL;
+        }
+
+        code = pgm_read_byte(autocorrect_data + state);
+
+        if (code & 128) { // A typo was found!
+            return autocorrect_data + state;
+        }
+    }
+    return NULL;
+}
+#endif
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -254,51 +351,24 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         return true;
     }
 
-    // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
-    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
-        uint8_t const key_i = typo_buffer[i];
-
-        if (code & 64) { // Check for match in node with multiple children.
-            code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
-                if (!code) return true;
+    // Check for typo in buffer.
+    const uint8_t *typo = autocorrect_find_typo();
+    if (typo) { // A typo was found! Apply autocorrect.
+        const uint8_t backspaces = (pgm_read_byte(typo) & 63) + !record->event.pressed;
+        if (apply_autocorrect(backspaces, (char const *)(typo + 1))) {
+            for (uint8_t i = 0; i < backspaces; ++i) {
+                tap_code(KC_BSPC);
             }
-            // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
-            // Check for match in node with single child.
-        } else if (code != key_i) {
-            return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
-            ++state;
+            send_string_P((char const *)(typo + 1));
         }
 
-        // Stop if `state` becomes an invalid index. This should not normally
-        // happen, it is a safeguard in case of a bug, data corruption, etc.
-        if (state >= DICTIONARY_SIZE) {
+        if (keycode == KC_SPC) {
+            typo_buffer[0]   = KC_SPC;
+            typo_buffer_size = 1;
             return true;
-        }
-
-        code = pgm_read_byte(autocorrect_data + state);
-
-        if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            if (apply_autocorrect(backspaces, (char const *)(autocorrect_data + state + 1))) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P((char const *)(autocorrect_data + state + 1));
-            }
-
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+        } else {
+            typo_buffer_size = 0;
+            return false;
         }
     }
     return true;
@@ -19,7 +19,16 @@
 #include "process_combo.h"
 #include "action_tapping.h"
 #include "action.h"
+#include "action_util.h"
 #include "keymap_introspection.h"
+#ifdef COMBO_KEYCODE_INDEX
+#    include <stdlib.h>
+#    include <string.h>
+#endif
+
+#if defined(COMBO_BITSET) && (defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO))
+#    error COMBO_BITSET does not track the order in which combo keys are pressed, it cannot be used with COMBO_MUST_PRESS_IN_ORDER
+#endif
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -185,9 +194,213 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
     return COMBO_TERM;
 }
 
+#ifdef COMBO_KEYCODE_INDEX
+// Every keycode that is part of a combo, sorted, its position is its key id
+static uint16_t *combo_keys        = NULL;
+static uint16_t  combo_keys_length = 0;
+// The combos of key id n are combo_key_combos[combo_key_start[n]] up to combo_key_start[n + 1], in ascending order
+static uint16_t *combo_key_start   = NULL;
+static uint16_t *combo_key_combos  = NULL;
+static bool      combo_index_built = false;
+
+#    ifdef COMBO_BITSET
+typedef uint32_t combo_bits_t;
+#        define COMBO_BITS_WORDS(bits) (((bits) + 31) / 32)
+#        define COMBO_BIT(bits, n) ((bits)[(n) / 32] & ((combo_bits_t)1 << ((n) % 32)))
+#        define COMBO_BIT_SET(bits, n) ((bits)[(n) / 32] |= ((combo_bits_t)1 << ((n) % 32)))
+#        define COMBO_BIT_CLEAR(bits, n) ((bits)[(n) / 32] &= ~((combo_bits_t)1 << ((n) % 32)))
+
+// The key ids of every combo, combo_key_words words per combo
+static combo_bits_t *combo_masks     = NULL;
+static uint16_t      combo_key_words = 0;
+// The key ids pressed since the combos were last cleared
+static combo_bits_t *combo_pressed = NULL;
+// The combos that were fully pressed since they were last cleared, the only ones with any state to clear
+static combo_bits_t *combo_touched       = NULL;
+static uint16_t      combo_touched_words = 0;
+#    endif
+
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_index_entry_t;
+
+static int combo_index_compare(const void *a, const void *b) {
+    const combo_index_entry_t *entry_a = a;
+    const combo_index_entry_t *entry_b = b;
+    if (entry_a->keycode != entry_b->keycode) {
+        return entry_a->keycode < entry_b->keycode ? -1 : 1;
+    }
+    return (entry_a->combo_index > entry_b->combo_index) - (entry_a->combo_index < entry_b->combo_index);
+}
+
+static void combo_index_free(void) {
+    free(combo_keys);
+    free(combo_key_start);
+    free(combo_key_combos);
+    combo_keys        = NULL;
+    combo_key_start   = NULL;
+    combo_key_combos  = NULL;
+    combo_keys_length = 0;
+#    ifdef COMBO_BITSET
+    free(combo_masks);
+    free(combo_pressed);
+    free(combo_touched);
+    combo_masks   = NULL;
+    combo_pressed = NULL;
+    combo_touched = NULL;
+#    endif
+}
+
+/* Returns the key id of keycode, or combo_keys_length if no combo contains
+ * it. */
+static uint16_t combo_key_find(uint16_t keycode) {
+    uint16_t low = 0, high = combo_keys_length;
+    while (low < high) {
+        uint16_t middle = low + (high - low) / 2;
+        if (combo_keys[middle] < keycode) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return (low < combo_keys_length && combo_keys[low] == keycode) ? low : combo_keys_length;
+}
+
+/* Builds the index on first use. Returns false if it could not be allocated,
+ * in which case every combo is checked for every key. */
+static bool combo_index_build(void) {
+    if (combo_index_built) {
+        return combo_keys != NULL;
+    }
+    combo_index_built = true;
+
+    uint16_t length = 0;
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        for (uint8_t i = 0; pgm_read_word(&keys[i]) != COMBO_END; i++) {
+            length++;
+        }
+    }
+    combo_index_entry_t *entries;
+    if (length == 0 || !(entries = malloc(length * sizeof(combo_index_entry_t)))) {
+        return false;
+    }
+
+    length = 0;
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        key;
+        for (uint8_t i = 0; (key = pgm_read_word(&keys[i])) != COMBO_END; i++) {
+            entries[length++] = (combo_index_entry_t){.keycode = key, .combo_index = idx};
+        }
+    }
+    qsort(entries, length, sizeof(combo_index_entry_t), combo_index_compare);
+
+    // A key listed twice in one combo is only indexed once
+    uint16_t key_count = 0, combo_key_count = 0;
+    for (uint16_t i = 0; i < length; i++) {
+        if (i == 0 || entries[i].keycode != entries[i - 1].keycode) {
+            key_count++;
+        } else if (entries[i].combo_index == entries[i - 1].combo_index) {
+            continue;
+        }
+        combo_key_count++;
+    }
+
+    combo_keys       = malloc(key_count * sizeof(uint16_t));
+    combo_key_start  = malloc((key_count + 1) * sizeof(uint16_t));
+    combo_key_combos = malloc(combo_key_count * sizeof(uint16_t));
+    bool allocated   = combo_keys && combo_key_start && combo_key_combos;
+#    ifdef COMBO_BITSET
+    combo_key_words     = COMBO_BITS_WORDS(key_count);
+    combo_touched_words = COMBO_BITS_WORDS(combo_count());
+    combo_masks         = calloc((size_t)combo_count() * combo_key_words, sizeof(combo_bits_t));
+    combo_pressed       = calloc(combo_key_words, sizeof(combo_bits_t));
+    combo_touched       = calloc(combo_touched_words, sizeof(combo_bits_t));
+    allocated           = allocated && combo_masks && combo_pressed && combo_touched;
+#    endif
+    if (!allocated) {
+        free(entries);
+        combo_index_free();
+        return false;
+    }
+
+    key_count = combo_key_count = 0;
+    for (uint16_t i = 0; i < length; i++) {
+        if (i == 0 || entries[i].keycode != entries[i - 1].keycode) {
+            combo_key_start[key_count] = combo_key_count;
+            combo_keys[key_count++]    = entries[i].keycode;
+        } else if (entries[i].combo_index == entries[i - 1].combo_index) {
+            continue;
+        }
+        combo_key_combos[combo_key_count++] = entries[i].combo_index;
+#    ifdef COMBO_BITSET
+        COMBO_BIT_SET(&combo_masks[entries[i].combo_index * combo_key_words], key_count - 1);
+#    endif
+    }
+    combo_key_start[key_count] = combo_key_count;
+    combo_keys_length          = key_count;
+
+    free(entries);
+    return true;
+}
+
+#    ifdef COMBO_BITSET
+static bool combo_bitset_all_down(uint16_t combo_index) {
+    const combo_bits_t *mask = &combo_masks[combo_index * combo_key_words];
+    for (uint16_t word = 0; word < combo_key_words; word++) {
+        if ((combo_pressed[word] & mask[word]) != mask[word]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void combo_bitset_clear(void) {
+    uint16_t count = combo_count();
+    for (uint16_t word = 0; word < combo_touched_words; word++) {
+        combo_bits_t touched = combo_touched[word];
+        for (uint8_t bit = 0; touched; bit++, touched >>= 1) {
+            uint16_t index = word * 32 + bit;
+            if (!(touched & 1) || index >= count) {
+                continue;
+            }
+            combo_t *combo = combo_get(index);
+            if (!COMBO_ACTIVE(combo)) {
+                RESET_COMBO_STATE(combo);
+                COMBO_BIT_CLEAR(combo_touched, index);
+            }
+        }
+    }
+    memset(combo_pressed, 0, combo_key_words * sizeof(combo_bits_t));
+}
+#    endif
+#endif
+
+/* Arms the timeout that fires the buffered combos, or drops the buffered
+ * keys, once the longest term of the pressed combos has passed. */
+static void schedule_combo_timeout(void) {
+#ifndef COMBO_NO_TIMER
+    if (!timer) {
+        timeout_cancel(TIMEOUT_COMBO);
+        return;
+    }
+    uint16_t elapsed = timer_elapsed(timer);
+    timeout_start(TIMEOUT_COMBO, elapsed > longest_term ? 0 : longest_term + 1 - elapsed, combo_task);
+#endif
+}
+
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_BITSET
+    if (combo_touched) {
+        // Only the combos that were fully pressed have any state to clear
+        combo_bitset_clear();
+        return;
+    }
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -196,6 +409,17 @@ void clear_combos(void) {
     }
 }
 
+#ifdef COMBO_KEYCODE_INDEX
+void combo_index_clear(void) {
+#    ifdef COMBO_BITSET
+    // The bitsets are the only record of which combos have state left
+    clear_combos();
+#    endif
+    combo_index_free();
+    combo_index_built = false;
+}
+#endif
+
 static inline void dump_key_buffer(void) {
     /* First call start from 0 index; recursive calls need to start from i+1 index */
     static uint8_t key_buffer_next = 0;
@@ -242,6 +466,7 @@ static inline void dump_key_buffer(void) {
         // only delay once and for a non-tapping key
         if (!delay_done && !is_tap_record(record)) {
             delay_done = true;
+            keyboard_report_batch_flush();
             wait_ms(TAP_CODE_DELAY);
         }
 #endif
@@ -250,7 +475,6 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -272,6 +496,21 @@ static inline void _find_key_index_and_count(const uint16_t *keys, uint16_t keyc
     }
 }
 
+#ifdef COMBO_BITSET
+/* Gives a combo that is being activated the per-key state that the bitset
+ * engine only keeps for active combos, from its keys that are still down. */
+static void combo_bitset_activate(combo_t *combo) {
+    uint16_t key;
+    RESET_COMBO_STATE(combo);
+    for (uint8_t i = 0; (key = pgm_read_word(&combo->keys[i])) != COMBO_END; i++) {
+        uint16_t key_id = combo_key_find(key);
+        if (key_id < combo_keys_length && COMBO_BIT(combo_pressed, key_id)) {
+            KEY_STATE_DOWN(combo->state, i);
+        }
+    }
+}
+#endif
+
 void drop_combo_from_buffer(uint16_t combo_index) {
     /* Mark a combo as processed from the buffer. If the buffer is in the
      * beginning of the buffer, drop it.  */
@@ -332,6 +571,9 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
 
             qrecord->combo_index = combo_index;
             ACTIVATE_COMBO(combo);
+#ifdef COMBO_BITSET
+            combo_bitset_activate(combo);
+#endif
 
             break;
         } else {
@@ -408,6 +650,96 @@ static bool keys_pressed_in_order(uint16_t combo_index, combo_t *combo, uint16_t
 }
 #endif
 
+/* Buffers a combo whose keys are all down, so that it fires once its term
+ * has passed, unless the term already has or an overlapping combo wins. */
+static void buffer_combo(uint16_t combo_index, combo_t *combo, uint16_t time) {
+#ifndef COMBO_NO_TIMER
+    /* Don't buffer this combo if its combo term has passed. */
+    if (timer && timer_elapsed(timer) > time) {
+        DISABLE_COMBO(combo);
+        return;
+    }
+#endif
+
+    // disable readied combos that overlap with this combo
+    combo_t *drop = NULL;
+    for (uint8_t combo_buffer_i = combo_buffer_read; combo_buffer_i != combo_buffer_write; INCREMENT_MOD(combo_buffer_i)) {
+        queued_combo_t *qcombo         = &combo_buffer[combo_buffer_i];
+        combo_t *       buffered_combo = combo_get(qcombo->combo_index);
+
+        if ((drop = overlaps(buffered_combo, combo))) {
+            DISABLE_COMBO(drop);
+            if (drop == combo) {
+                // stop checking for overlaps if dropped combo was current combo.
+                break;
+            } else if (combo_buffer_i == combo_buffer_read && drop == buffered_combo) {
+                /* Drop the disabled buffered combo from the buffer if
+                 * it is in the beginning of the buffer. */
+                INCREMENT_MOD(combo_buffer_read);
+            }
+        }
+    }
+
+    if (drop != combo) {
+        // save this combo to buffer
+        combo_buffer[combo_buffer_write] = (queued_combo_t){
+            .combo_index = combo_index,
+        };
+        INCREMENT_MOD(combo_buffer_write);
+
+        // get possible longer waiting time for tap-/hold-only combos.
+        longest_term = _get_wait_time(combo_index, combo);
+    }
+}
+
+/* Handles a released key of the combo, or a press the combo ignores, and
+ * returns whether the key is part of the combo. The caller clears the key
+ * from the combo's state afterwards. */
+static bool release_combo_key(uint16_t combo_index, combo_t *combo, uint16_t key_index, uint16_t keycode, bool key_is_part_of_combo, bool all_keys_down) {
+    if (!COMBO_ACTIVE(combo) && all_keys_down) {
+        /* First key quickly released */
+        if (COMBO_DISABLED(combo) || _get_combo_must_hold(combo_index, combo)) {
+            // combo wasn't tappable, disable it and drop it from buffer.
+            drop_combo_from_buffer(combo_index);
+            key_is_part_of_combo = false;
+        }
+#ifdef COMBO_MUST_TAP_PER_COMBO
+        else if (get_combo_must_tap(combo_index, combo)) {
+            // immediately apply tap-only combo
+            apply_combo(combo_index, combo);
+            apply_combos(); // also apply other prepared combos and dump key buffer
+#    ifdef COMBO_PROCESS_KEY_RELEASE
+            if (process_combo_key_release(combo_index, combo, key_index, keycode)) {
+                release_combo(combo_index, combo);
+            }
+#    endif
+        }
+#endif
+    } else if (COMBO_ACTIVE(combo) && ONLY_ONE_KEY_IS_DOWN(COMBO_STATE(combo)) && KEY_NOT_YET_RELEASED(COMBO_STATE(combo), key_index)) {
+        /* last key released */
+        release_combo(combo_index, combo);
+        key_is_part_of_combo = true;
+
+#ifdef COMBO_PROCESS_KEY_RELEASE
+        process_combo_key_release(combo_index, combo, key_index, keycode);
+#endif
+    } else if (COMBO_ACTIVE(combo) && KEY_NOT_YET_RELEASED(COMBO_STATE(combo), key_index)) {
+        /* first or middle key released */
+        key_is_part_of_combo = true;
+
+#ifdef COMBO_PROCESS_KEY_RELEASE
+        if (process_combo_key_release(combo_index, combo, key_index, keycode)) {
+            release_combo(combo_index, combo);
+        }
+#endif
+    } else {
+        /* The released key was part of an incomplete combo */
+        key_is_part_of_combo = false;
+    }
+
+    return key_is_part_of_combo;
+}
+
 static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
     uint8_t  key_count = 0;
     uint16_t key_index = -1;
@@ -438,99 +770,70 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
         if (ALL_COMBO_KEYS_ARE_DOWN(COMBO_STATE(combo), key_count)) {
             /* Combo was fully pressed */
             /* Buffer the combo so we can fire it after COMBO_TERM */
-
-#ifndef COMBO_NO_TIMER
-            /* Don't buffer this combo if its combo term has passed. */
-            if (timer && timer_elapsed(timer) > time) {
-                DISABLE_COMBO(combo);
-                return true;
-            } else
-#endif
-            {
-
-                // disable readied combos that overlap with this combo
-                combo_t *drop = NULL;
-                for (uint8_t combo_buffer_i = combo_buffer_read; combo_buffer_i != combo_buffer_write; INCREMENT_MOD(combo_buffer_i)) {
-                    queued_combo_t *qcombo         = &combo_buffer[combo_buffer_i];
-                    combo_t *       buffered_combo = combo_get(qcombo->combo_index);
-
-                    if ((drop = overlaps(buffered_combo, combo))) {
-                        DISABLE_COMBO(drop);
-                        if (drop == combo) {
-                            // stop checking for overlaps if dropped combo was current combo.
-                            break;
-                        } else if (combo_buffer_i == combo_buffer_read && drop == buffered_combo) {
-                            /* Drop the disabled buffered combo from the buffer if
-                             * it is in the beginning of the buffer. */
-                            INCREMENT_MOD(combo_buffer_read);
-                        }
-                    }
-                }
-
-                if (drop != combo) {
-                    // save this combo to buffer
-                    combo_buffer[combo_buffer_write] = (queued_combo_t){
-                        .combo_index = combo_index,
-                    };
-                    INCREMENT_MOD(combo_buffer_write);
-
-                    // get possible longer waiting time for tap-/hold-only combos.
-                    longest_term = _get_wait_time(combo_index, combo);
-                }
-            } // if timer elapsed end
+            buffer_combo(combo_index, combo, time);
         }
     } else {
         // chord releases
-        if (!COMBO_ACTIVE(combo) && ALL_COMBO_KEYS_ARE_DOWN(COMBO_STATE(combo), key_count)) {
-            /* First key quickly released */
-            if (COMBO_DISABLED(combo) || _get_combo_must_hold(combo_index, combo)) {
-                // combo wasn't tappable, disable it and drop it from buffer.
-                drop_combo_from_buffer(combo_index);
-                key_is_part_of_combo = false;
-            }
-#ifdef COMBO_MUST_TAP_PER_COMBO
-            else if (get_combo_must_tap(combo_index, combo)) {
-                // immediately apply tap-only combo
-                apply_combo(combo_index, combo);
-                apply_combos(); // also apply other prepared combos and dump key buffer
-#    ifdef COMBO_PROCESS_KEY_RELEASE
-                if (process_combo_key_release(combo_index, combo, key_index, keycode)) {
-                    release_combo(combo_index, combo);
-                }
+        key_is_part_of_combo = release_combo_key(combo_index, combo, key_index, keycode, key_is_part_of_combo, ALL_COMBO_KEYS_ARE_DOWN(COMBO_STATE(combo), key_count));
+        KEY_STATE_UP(combo->state, key_index);
+    }
+
+    return key_is_part_of_combo;
+}
+
+#ifdef COMBO_BITSET
+/* process_single_combo() for the bitset engine, which is only called for the
+ * combos containing the key. Whether all keys of a combo are down is read
+ * from combo_pressed, so only active combos keep a per-key state. Inactive
+ * combos use their state for the keys that are down but were rejected for
+ * them, which process_single_combo() leaves out of the state instead. */
+static bool process_bitset_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
+    bool key_is_part_of_combo = (!COMBO_DISABLED(combo) && is_combo_enabled()
+#    ifdef COMBO_SHOULD_TRIGGER
+                                 && combo_should_trigger(combo_index, combo, keycode, record)
 #    endif
-            }
-#endif
-        } else if (COMBO_ACTIVE(combo) && ONLY_ONE_KEY_IS_DOWN(COMBO_STATE(combo)) && KEY_NOT_YET_RELEASED(COMBO_STATE(combo), key_index)) {
-            /* last key released */
-            release_combo(combo_index, combo);
-            key_is_part_of_combo = true;
+    );
 
-#ifdef COMBO_PROCESS_KEY_RELEASE
-            process_combo_key_release(combo_index, combo, key_index, keycode);
-#endif
-        } else if (COMBO_ACTIVE(combo) && KEY_NOT_YET_RELEASED(COMBO_STATE(combo), key_index)) {
-            /* first or middle key released */
-            key_is_part_of_combo = true;
+    uint8_t  key_count = 0;
+    uint16_t key_index = -1;
+    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
 
-#ifdef COMBO_PROCESS_KEY_RELEASE
-            if (process_combo_key_release(combo_index, combo, key_index, keycode)) {
-                release_combo(combo_index, combo);
+    if (record->event.pressed) {
+        if (!COMBO_ACTIVE(combo)) {
+            if (!key_is_part_of_combo) {
+                KEY_STATE_DOWN(combo->state, key_index);
+                COMBO_BIT_SET(combo_touched, combo_index);
+                return false;
+            }
+            KEY_STATE_UP(combo->state, key_index);
+
+            uint16_t time = _get_combo_term(combo_index, combo);
+            if (longest_term < time) {
+                longest_term = time;
+            }
+            if (!COMBO_STATE(combo) && combo_bitset_all_down(combo_index)) {
+                COMBO_BIT_SET(combo_touched, combo_index);
+                buffer_combo(combo_index, combo, time);
             }
-#endif
-        } else {
-            /* The released key was part of an incomplete combo */
-            key_is_part_of_combo = false;
         }
+        return key_is_part_of_combo;
+    }
 
+    bool all_keys_down = !COMBO_ACTIVE(combo) && !COMBO_STATE(combo) && combo_bitset_all_down(combo_index);
+    if (!COMBO_ACTIVE(combo) && !all_keys_down) {
+        /* The released key was part of an incomplete combo */
         KEY_STATE_UP(combo->state, key_index);
+        return false;
     }
 
+    key_is_part_of_combo = release_combo_key(combo_index, combo, key_index, keycode, key_is_part_of_combo, all_keys_down);
+    KEY_STATE_UP(combo->state, key_index);
     return key_is_part_of_combo;
 }
+#endif
 
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    bool is_combo_key          = false;
-    bool no_combo_keys_pressed = true;
+    bool is_combo_key = false;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -558,10 +861,37 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEYCODE_INDEX
+    uint16_t key_id;
+    if (combo_index_build()) {
+        /* Only the combos containing keycode, in the same order as below. */
+        if ((key_id = combo_key_find(keycode)) < combo_keys_length) {
+#    ifdef COMBO_BITSET
+            if (record->event.pressed && is_combo_enabled()) {
+                COMBO_BIT_SET(combo_pressed, key_id);
+            }
+#    endif
+            for (uint16_t i = combo_key_start[key_id]; i < combo_key_start[key_id + 1]; i++) {
+                uint16_t idx = combo_key_combos[i];
+#    ifdef COMBO_BITSET
+                is_combo_key |= process_bitset_combo(combo_get(idx), keycode, record, idx);
+#    else
+                is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+#    endif
+            }
+#    ifdef COMBO_BITSET
+            if (!record->event.pressed) {
+                COMBO_BIT_CLEAR(combo_pressed, key_id);
+            }
+#    endif
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -596,6 +926,7 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
             clear_combos();
         }
     }
+    schedule_combo_timeout();
     return !is_combo_key;
 }
 
@@ -627,6 +958,7 @@ void combo_disable(void) {
 #ifndef COMBO_NO_TIMER
     timer = 0;
 #endif
+    schedule_combo_timeout();
     b_combo_enable    = false;
     combo_buffer_read = combo_buffer_write;
     clear_combos();
@@ -37,6 +37,11 @@
 #    define COMBO_BUFFER_LENGTH 4
 #endif
 
+// The bitset engine finds the combos of a key through the keycode index
+#if defined(COMBO_BITSET) && !defined(COMBO_KEYCODE_INDEX)
+#    define COMBO_KEYCODE_INDEX
+#endif
+
 typedef struct combo_t {
     const uint16_t *keys;
     uint16_t        keycode;
@@ -79,3 +84,11 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_KEYCODE_INDEX
+/* Rebuilds the keycode index on the next key event, call it whenever what
+ * combo_count() or combo_get() return changes at runtime. */
+void combo_index_clear(void);
+#else
+#    define combo_index_clear()
+#endif
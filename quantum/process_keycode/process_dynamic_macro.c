@@ -91,6 +91,7 @@ void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_
         process_record(macro_buffer);
         macro_buffer += direction;
 #ifdef DYNAMIC_MACRO_DELAY
+        keyboard_report_batch_flush();
         wait_ms(DYNAMIC_MACRO_DELAY);
 #endif
     }
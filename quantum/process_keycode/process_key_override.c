@@ -21,14 +21,14 @@
 #include "process_key_override.h"
 
 #include <debug.h>
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX
+#    include <stdlib.h>
+#endif
 
 #ifndef KEY_OVERRIDE_REPEAT_DELAY
 #    define KEY_OVERRIDE_REPEAT_DELAY 500
 #endif
 
-// For benchmarking the time it takes to call process_key_override on every key press (needs keyboard debugging enabled as well)
-// #define BENCH_KEY_OVERRIDE
-
 // For debug output (needs keyboard debugging enabled as well)
 // #define DEBUG_KEY_OVERRIDE
 
@@ -155,6 +155,7 @@ static void schedule_deferred_register(const uint16_t keycode) {
         defer_delay          = 50; // 50ms
     }
     deferred_register = keycode;
+    timeout_start(TIMEOUT_KEY_OVERRIDE, defer_delay - timer_elapsed32(defer_reference_time), key_override_task);
 }
 
 const key_override_t *clear_active_override(const bool allow_reregister) {
@@ -243,14 +244,127 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX
+// Positions in key_overrides, sorted by trigger and then by position, for the array in override_index_source
+static uint8_t *               override_index        = NULL;
+static uint8_t                 override_index_length = 0;
+static const key_override_t **override_index_source = NULL;
+
+static int override_index_compare(const void *a, const void *b) {
+    const uint8_t  index_a   = *(const uint8_t *)a;
+    const uint8_t  index_b   = *(const uint8_t *)b;
+    const uint16_t trigger_a = key_overrides[index_a]->trigger;
+    const uint16_t trigger_b = key_overrides[index_b]->trigger;
+    if (trigger_a != trigger_b) {
+        return trigger_a < trigger_b ? -1 : 1;
+    }
+    return (index_a > index_b) - (index_a < index_b);
+}
+
+/** Builds the index whenever key_overrides points to a different array. Returns false if there is no index, in which case every override is checked. */
+static bool override_index_build(void) {
+    if (override_index_source == key_overrides) {
+        return override_index != NULL;
+    }
+
+    free(override_index);
+    override_index        = NULL;
+    override_index_length = 0;
+    override_index_source = key_overrides;
+
+    uint8_t count = 0;
+    while (key_overrides[count] != NULL) {
+        count++;
+    }
+    if (count == 0 || !(override_index = malloc(count))) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        override_index[i] = i;
+    }
+    qsort(override_index, count, sizeof(uint8_t), override_index_compare);
+    override_index_length = count;
+    return true;
+}
+
+/** Returns the position of the first override with the given trigger in override_index, or of the next larger trigger if there is none. */
+static uint8_t override_index_find(const uint16_t trigger) {
+    uint8_t low = 0, high = override_index_length;
+    while (low < high) {
+        uint8_t middle = low + (high - low) / 2;
+        if (key_overrides[override_index[middle]]->trigger < trigger) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// An override can only activate if its trigger is KC_NO, the key of the event or the last key that went down
+#    define OVERRIDE_CANDIDATE_TRIGGERS 3
+
+typedef struct {
+    uint8_t next[OVERRIDE_CANDIDATE_TRIGGERS];
+    uint8_t end[OVERRIDE_CANDIDATE_TRIGGERS];
+} override_candidates_t;
+
+static void override_candidates_init(override_candidates_t *candidates, const uint16_t keycode) {
+    const uint16_t triggers[OVERRIDE_CANDIDATE_TRIGGERS] = {KC_NO, keycode, last_key_down};
+
+    for (uint8_t i = 0; i < OVERRIDE_CANDIDATE_TRIGGERS; i++) {
+        uint8_t position    = override_index_find(triggers[i]);
+        candidates->next[i] = position;
+        candidates->end[i]  = position;
+
+        // The same trigger twice would yield its overrides twice
+        bool duplicate = false;
+        for (uint8_t j = 0; j < i; j++) {
+            duplicate |= triggers[j] == triggers[i];
+        }
+        while (!duplicate && candidates->end[i] < override_index_length && key_overrides[override_index[candidates->end[i]]]->trigger == triggers[i]) {
+            candidates->end[i]++;
+        }
+    }
+}
+
+/** Returns the candidate that comes first in key_overrides and moves past it, or NULL once there are none left. */
+static const key_override_t *override_candidates_next(override_candidates_t *candidates) {
+    uint8_t first = OVERRIDE_CANDIDATE_TRIGGERS;
+    for (uint8_t i = 0; i < OVERRIDE_CANDIDATE_TRIGGERS; i++) {
+        if (candidates->next[i] < candidates->end[i] && (first == OVERRIDE_CANDIDATE_TRIGGERS || override_index[candidates->next[i]] < override_index[candidates->next[first]])) {
+            first = i;
+        }
+    }
+    if (first == OVERRIDE_CANDIDATE_TRIGGERS) {
+        return NULL;
+    }
+    return key_overrides[override_index[candidates->next[first]++]];
+}
+#endif
+
 /** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
 static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
     if (key_overrides == NULL) {
         return true;
     }
 
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX
+    // Only the overrides whose trigger can be down, in the same order as key_overrides
+    override_candidates_t candidates;
+    const bool            indexed = override_index_build();
+    if (indexed) {
+        override_candidates_init(&candidates, keycode);
+    }
+#endif
+
     for (uint8_t i = 0;; i++) {
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX
+        const key_override_t *const override = indexed ? override_candidates_next(&candidates) : key_overrides[i];
+#else
         const key_override_t *const override = key_overrides[i];
+#endif
 
         // End of array
         if (override == NULL) {
@@ -361,6 +475,7 @@ static bool try_activating_override(const uint16_t keycode, const uint8_t layer,
                 } else {
                     key_override_printf("NOT KEY 2\n");
                     send_keyboard_report();
+                    keyboard_report_batch_flush();
                     // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
                     wait_ms(10);
                     register_code(mod_free_replacement);
@@ -397,10 +512,6 @@ void key_override_task(void) {
 }
 
 bool process_key_override(const uint16_t keycode, const keyrecord_t *const record) {
-#ifdef BENCH_KEY_OVERRIDE
-    uint16_t start = timer_read();
-#endif
-
     const bool key_down = record->event.pressed;
     const bool is_mod   = IS_MODIFIER_KEYCODE(keycode);
 
@@ -510,11 +621,5 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
         }
     }
 
-#ifdef BENCH_KEY_OVERRIDE
-    uint16_t elapsed = timer_elapsed(start);
-
-    dprintf("Processing key overrides took: %u ms\n", elapsed);
-#endif
-
     return send_key_action;
 }
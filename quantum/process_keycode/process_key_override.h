@@ -106,7 +106,7 @@ bool key_override_is_enabled(void);
 /** Handling of key overrides and its implemented keycodes */
 bool process_key_override(const uint16_t keycode, const keyrecord_t *const record);
 
-/** Perform any deferred keys */
+/** Perform any deferred keys, called by the timeout service once they are due */
 void key_override_task(void);
 
 /**
@@ -38,6 +38,11 @@ bool process_leader(uint16_t keycode, keyrecord_t *record) {
             leader_reset_timer();
 #endif
 
+            // No other sequence can match anymore, so there is no need to wait for the timeout
+            if (leader_sequence_complete()) {
+                leader_end();
+            }
+
             return false;
         } else if (keycode == QK_LEADER) {
             leader_start();
@@ -37,6 +37,7 @@ void tap_dance_pair_reset(tap_dance_state_t *state, void *user_data) {
     tap_dance_pair_t *pair = (tap_dance_pair_t *)user_data;
 
     if (state->count == 1) {
+        keyboard_report_batch_flush();
         wait_ms(TAP_CODE_DELAY);
         unregister_code16(pair->kc1);
     } else if (state->count == 2) {
@@ -67,6 +68,7 @@ void tap_dance_dual_role_reset(tap_dance_state_t *state, void *user_data) {
     tap_dance_dual_role_t *pair = (tap_dance_dual_role_t *)user_data;
 
     if (state->count == 1) {
+        keyboard_report_batch_flush();
         wait_ms(TAP_CODE_DELAY);
         unregister_code16(pair->kc);
     }
@@ -150,6 +152,9 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
                 last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action);
                 active_td = action->state.finished ? 0 : keycode;
+                if (active_td) {
+                    timeout_start(TIMEOUT_TAP_DANCE, GET_TAPPING_TERM(active_td, &(keyrecord_t){}) + 1, tap_dance_task);
+                }
             } else {
                 if (action->state.finished) {
                     process_tap_dance_action_on_reset(action);
@@ -21,7 +21,11 @@
 bool process_unicode(uint16_t keycode, keyrecord_t *record) {
     if (record->event.pressed) {
         if (keycode >= QK_UNICODE && keycode <= QK_UNICODE_MAX) {
+#if defined(SEND_STRING_ASYNC_ENABLE) && defined(UNICODE_ASYNC_KEYCODES)
+            register_unicode_async(QK_UNICODE_GET_CODE_POINT(keycode));
+#else
             register_unicode(QK_UNICODE_GET_CODE_POINT(keycode));
+#endif
         }
     }
     return true;
@@ -57,6 +57,11 @@ bool process_unicode_common(uint16_t keycode, keyrecord_t *record) {
                 break;
         }
     }
+#ifdef SEND_STRING_ASYNC_ENABLE
+    else {
+        unicode_async_key_released(keycode);
+    }
+#endif
 
 #if defined(UNICODE_ENABLE)
     return process_unicode(keycode, record);
@@ -49,7 +49,11 @@ __attribute__((weak)) uint16_t unicodemap_index(uint16_t keycode) {
 bool process_unicodemap(uint16_t keycode, keyrecord_t *record) {
     if (keycode >= QK_UNICODEMAP && keycode <= QK_UNICODEMAP_PAIR_MAX && record->event.pressed) {
         uint32_t code_point = pgm_read_dword(unicode_map + unicodemap_index(keycode));
+#if defined(SEND_STRING_ASYNC_ENABLE) && defined(UNICODE_ASYNC_KEYCODES)
+        register_unicode_async(code_point);
+#else
         register_unicode(code_point);
+#endif
     }
     return true;
 }
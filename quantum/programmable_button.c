@@ -17,6 +17,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "programmable_button.h"
 #include "host.h"
+#include "action_util.h"
 
 #define REPORT_BIT(index) (((uint32_t)1) << (index - 1))
 
@@ -50,6 +51,7 @@ bool programmable_button_is_on(uint8_t index) {
 }
 
 void programmable_button_flush(void) {
+    keyboard_report_batch_flush();
     host_programmable_button_send(programmable_button_report);
 }
 
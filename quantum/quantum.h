@@ -45,6 +45,7 @@
 #include "bootmagic.h"
 #include "timer.h"
 #include "sync_timer.h"
+#include "timeout.h"
 #include "gpio.h"
 #include "atomic_util.h"
 #include "host.h"
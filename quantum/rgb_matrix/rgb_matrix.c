@@ -441,6 +441,15 @@ void rgb_matrix_task(void) {
     }
 }
 
+uint32_t rgb_matrix_task_interval(void) {
+    // Only a finished frame waits for anything, every other state advances on the next call
+    if (rgb_task_state != SYNCING) {
+        return 0;
+    }
+    uint32_t elapsed = sync_timer_elapsed32(g_rgb_timer);
+    return elapsed >= RGB_MATRIX_LED_FLUSH_LIMIT ? 0 : RGB_MATRIX_LED_FLUSH_LIMIT - elapsed;
+}
+
 void rgb_matrix_indicators(void) {
     rgb_matrix_indicators_kb();
 }
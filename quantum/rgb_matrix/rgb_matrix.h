@@ -130,6 +130,9 @@ void process_rgb_matrix(uint8_t row, uint8_t col, bool pressed);
 
 void rgb_matrix_task(void);
 
+// Milliseconds until rgb_matrix_task() next has work to do
+uint32_t rgb_matrix_task_interval(void);
+
 // This runs after another backlight effect and replaces
 // colors already set
 void rgb_matrix_indicators(void);
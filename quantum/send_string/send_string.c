@@ -22,6 +22,7 @@
 #include "quantum_keycodes.h"
 #include "keycode.h"
 #include "action.h"
+#include "action_util.h"
 #include "wait.h"
 
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
@@ -146,6 +147,86 @@ __attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
 // Note: we bit-pack in "reverse" order to optimize loading
 #define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
 
+#if defined(SEND_STRING_NKRO_PACKING) && defined(NKRO_ENABLE)
+#    include "host.h"
+#    include "keycode_config.h"
+
+#    ifndef SEND_STRING_NKRO_PACKING_KEYS
+#        define SEND_STRING_NKRO_PACKING_KEYS 16
+#    endif
+
+/* Consecutive characters that need the same modifiers and have ascending
+ * keycodes are pressed together in one NKRO report, and released together in
+ * the next. The host walks the NKRO bitmap in keycode order, so such a run is
+ * still typed in order. Anything else starts a new run, or is sent on its own.
+ */
+static uint8_t packed_keys[SEND_STRING_NKRO_PACKING_KEYS];
+static uint8_t packed_count = 0;
+static uint8_t packed_mods  = 0;
+
+static void send_packed_keys(void) {
+    if (!packed_count) {
+        return;
+    }
+    send_keyboard_report();
+    keyboard_report_batch_flush();
+    for (uint16_t i = TAP_CODE_DELAY; i > 0; i--) {
+        wait_ms(1);
+    }
+    for (uint8_t i = 0; i < packed_count; i++) {
+        del_key(packed_keys[i]);
+    }
+    del_mods(packed_mods);
+    send_keyboard_report();
+    packed_count = 0;
+}
+
+static bool pack_char(char ascii_code) {
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') {
+        return false;
+    }
+#    endif
+
+    uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    if (!keycode || PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code)) {
+        return false;
+    }
+    uint8_t mods = 0;
+    if (PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code)) {
+        mods |= MOD_BIT(KC_LEFT_SHIFT);
+    }
+    if (PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code)) {
+        mods |= MOD_BIT(KC_RIGHT_ALT);
+    }
+
+    if (packed_count && (mods != packed_mods || keycode <= packed_keys[packed_count - 1] || packed_count == SEND_STRING_NKRO_PACKING_KEYS)) {
+        send_packed_keys();
+    }
+    if (!packed_count) {
+        // The modifiers go out ahead of the keys, as they do for send_char()
+        packed_mods = mods;
+        if (mods) {
+            add_mods(mods);
+            send_keyboard_report();
+        }
+    }
+    packed_keys[packed_count++] = keycode;
+    add_key(keycode);
+    return true;
+}
+
+static void send_string_char(char ascii_code, uint8_t interval) {
+    if (interval || !keyboard_protocol || !keymap_config.nkro || !pack_char(ascii_code)) {
+        send_packed_keys();
+        send_char(ascii_code);
+    }
+}
+#else
+#    define send_packed_keys()
+#    define send_string_char(ascii_code, interval) send_char(ascii_code)
+#endif
+
 void send_string(const char *string) {
     send_string_with_delay(string, 0);
 }
@@ -155,6 +236,7 @@ void send_string_with_delay(const char *string, uint8_t interval) {
         char ascii_code = *string;
         if (!ascii_code) break;
         if (ascii_code == SS_QMK_PREFIX) {
+            send_packed_keys();
             ascii_code = *(++string);
             if (ascii_code == SS_TAP_CODE) {
                 // tap
@@ -177,20 +259,23 @@ void send_string_with_delay(const char *string, uint8_t interval) {
                     ms += keycode - '0';
                     keycode = *(++string);
                 }
+                keyboard_report_batch_flush();
                 while (ms--)
                     wait_ms(1);
             }
         } else {
-            send_char(ascii_code);
+            send_string_char(ascii_code, interval);
         }
         ++string;
         // interval
         {
             uint8_t ms = interval;
+            keyboard_report_batch_flush();
             while (ms--)
                 wait_ms(1);
         }
     }
+    send_packed_keys();
 }
 
 void send_char(char ascii_code) {
@@ -288,6 +373,7 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
         char ascii_code = pgm_read_byte(string);
         if (!ascii_code) break;
         if (ascii_code == SS_QMK_PREFIX) {
+            send_packed_keys();
             ascii_code = pgm_read_byte(++string);
             if (ascii_code == SS_TAP_CODE) {
                 // tap
@@ -310,19 +396,282 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
                     ms += keycode - '0';
                     keycode = pgm_read_byte(++string);
                 }
+                keyboard_report_batch_flush();
                 while (ms--)
                     wait_ms(1);
             }
         } else {
-            send_char(ascii_code);
+            send_string_char(ascii_code, interval);
         }
         ++string;
         // interval
         {
             uint8_t ms = interval;
+            keyboard_report_batch_flush();
             while (ms--)
                 wait_ms(1);
         }
     }
+    send_packed_keys();
+}
+#endif
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include <string.h>
+#    include "eeprom.h"
+#    include "timeout.h"
+
+#    ifndef SEND_STRING_ASYNC_QUEUE_SIZE
+#        define SEND_STRING_ASYNC_QUEUE_SIZE 4
+#    endif
+
+#    ifndef SEND_STRING_ASYNC_BUFFER_SIZE
+#        define SEND_STRING_ASYNC_BUFFER_SIZE 64
+#    endif
+
+typedef enum send_string_source_t {
+    SEND_STRING_SOURCE_RAM,
+    SEND_STRING_SOURCE_PROGMEM,
+    SEND_STRING_SOURCE_EEPROM,
+    SEND_STRING_SOURCE_READER,
+} send_string_source_t;
+
+typedef struct send_string_job_t {
+    uint8_t                      source;
+    uint8_t                      interval;
+    uint16_t                     length; // bytes taken from the buffer, RAM strings only
+    uintptr_t                    address; // buffer offset for RAM strings, reader argument for readers
+    uint16_t                     position;
+    send_string_async_reader_t   reader;
+    send_string_async_callback_t callback;
+    void *                       cb_arg;
+} send_string_job_t;
+
+typedef struct send_string_action_t {
+    uint8_t  keycode;
+    bool     pressed;
+    uint16_t delay;
+} send_string_action_t;
+
+static send_string_job_t jobs[SEND_STRING_ASYNC_QUEUE_SIZE];
+static uint8_t           job_head  = 0;
+static uint8_t           job_count = 0;
+
+// RAM strings are copied into this ring, and released in the same order the jobs finish
+static char     buffer[SEND_STRING_ASYNC_BUFFER_SIZE];
+static uint16_t buffer_head = 0;
+static uint16_t buffer_used = 0;
+
+// The key events of the character being typed, and how long to wait once they have all been sent
+static send_string_action_t actions[8];
+static uint8_t              action_count = 0;
+static uint8_t              action_index = 0;
+static uint16_t             token_delay  = 0;
+static bool                 token_active = false;
+
+static char job_read(send_string_job_t *job) {
+    uint16_t position = job->position++;
+    switch (job->source) {
+        case SEND_STRING_SOURCE_RAM:
+            return buffer[(job->address + position) % SEND_STRING_ASYNC_BUFFER_SIZE];
+        case SEND_STRING_SOURCE_PROGMEM:
+            return pgm_read_byte((const char *)job->address + position);
+        case SEND_STRING_SOURCE_READER:
+            return job->reader((void *)job->address, position);
+        default:
+            return eeprom_read_byte((const uint8_t *)job->address + position);
+    }
+}
+
+static void add_action(uint8_t keycode, bool pressed, uint16_t delay) {
+    actions[action_count++] = (send_string_action_t){.keycode = keycode, .pressed = pressed, .delay = delay};
+}
+
+static void add_tap(uint8_t keycode) {
+    add_action(keycode, true, keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+    add_action(keycode, false, 0);
+}
+
+/* Decodes the next character or SS_ sequence of the job into key events,
+ * mirroring send_string_with_delay() and send_char(). Returns false once the
+ * string ends. */
+static bool decode_token(send_string_job_t *job) {
+    action_count = 0;
+    action_index = 0;
+    token_delay  = job->interval;
+
+    char ascii_code = job_read(job);
+    if (!ascii_code) {
+        return false;
+    }
+
+    if (ascii_code == SS_QMK_PREFIX) {
+        ascii_code = job_read(job);
+        if (ascii_code == SS_TAP_CODE || ascii_code == SS_DOWN_CODE || ascii_code == SS_UP_CODE) {
+            uint8_t keycode = job_read(job);
+            if (!keycode) {
+                return false;
+            }
+            if (ascii_code == SS_TAP_CODE) {
+                add_tap(keycode);
+            } else {
+                add_action(keycode, ascii_code == SS_DOWN_CODE, 0);
+            }
+        } else if (ascii_code == SS_DELAY_CODE) {
+            uint16_t ms      = 0;
+            char     keycode = job_read(job);
+            while (isdigit(keycode)) {
+                ms *= 10;
+                ms += keycode - '0';
+                keycode = job_read(job);
+            }
+            if (!keycode) {
+                return false;
+            }
+            token_delay += ms;
+        } else if (!ascii_code) {
+            return false;
+        }
+        return true;
+    }
+
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        PLAY_SONG(bell_song);
+        return true;
+    }
+#    endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+    if (is_shifted) {
+        add_action(KC_LEFT_SHIFT, true, 0);
+    }
+    if (is_altgred) {
+        add_action(KC_RIGHT_ALT, true, 0);
+    }
+    add_tap(keycode);
+    if (is_altgred) {
+        add_action(KC_RIGHT_ALT, false, 0);
+    }
+    if (is_shifted) {
+        add_action(KC_LEFT_SHIFT, false, 0);
+    }
+    if (is_dead) {
+        add_tap(KC_SPACE);
+    }
+    return true;
+}
+
+static void finish_job(void) {
+    send_string_job_t *job = &jobs[job_head];
+    if (job->source == SEND_STRING_SOURCE_RAM) {
+        buffer_head = (buffer_head + job->length) % SEND_STRING_ASYNC_BUFFER_SIZE;
+        buffer_used -= job->length;
+    }
+    job_head = (job_head + 1) % SEND_STRING_ASYNC_QUEUE_SIZE;
+    --job_count;
+    if (job->callback) {
+        job->callback(job->cb_arg);
+    }
+}
+
+void send_string_async_task(void) {
+    while (true) {
+        // Send the key events of the current character, waiting wherever a tap needs a delay
+        while (action_index < action_count) {
+            send_string_action_t *action = &actions[action_index++];
+            if (action->pressed) {
+                register_code(action->keycode);
+            } else {
+                unregister_code(action->keycode);
+            }
+            if (action->delay) {
+                timeout_start(TIMEOUT_SEND_STRING, action->delay, send_string_async_task);
+                return;
+            }
+        }
+
+        // Then type the next character on a later run at the earliest, so that the matrix keeps being scanned
+        if (token_active) {
+            token_active = false;
+            timeout_start(TIMEOUT_SEND_STRING, token_delay, send_string_async_task);
+            return;
+        }
+
+        if (!job_count) {
+            return;
+        }
+        if (decode_token(&jobs[job_head])) {
+            token_active = true;
+        } else {
+            finish_job();
+        }
+    }
+}
+
+static bool queue_job(send_string_job_t job) {
+    if (job_count >= SEND_STRING_ASYNC_QUEUE_SIZE) {
+        return false;
+    }
+    jobs[(job_head + job_count) % SEND_STRING_ASYNC_QUEUE_SIZE] = job;
+    if (!job_count++) {
+        timeout_start(TIMEOUT_SEND_STRING, 0, send_string_async_task);
+    }
+    return true;
+}
+
+bool send_string_async(const char *string, uint8_t interval, send_string_async_callback_t callback, void *cb_arg) {
+    size_t length = strlen(string) + 1;
+    if (job_count >= SEND_STRING_ASYNC_QUEUE_SIZE || length > SEND_STRING_ASYNC_BUFFER_SIZE - buffer_used) {
+        return false;
+    }
+
+    uint16_t start = (buffer_head + buffer_used) % SEND_STRING_ASYNC_BUFFER_SIZE;
+    for (size_t i = 0; i < length; ++i) {
+        buffer[(start + i) % SEND_STRING_ASYNC_BUFFER_SIZE] = string[i];
+    }
+    buffer_used += length;
+
+    return queue_job((send_string_job_t){.source = SEND_STRING_SOURCE_RAM, .interval = interval, .length = length, .address = start, .callback = callback, .cb_arg = cb_arg});
+}
+
+bool send_string_async_P(const char *string, uint8_t interval, send_string_async_callback_t callback, void *cb_arg) {
+    return queue_job((send_string_job_t){.source = SEND_STRING_SOURCE_PROGMEM, .interval = interval, .address = (uintptr_t)string, .callback = callback, .cb_arg = cb_arg});
+}
+
+bool send_string_async_eeprom(const void *string, uint8_t interval, send_string_async_callback_t callback, void *cb_arg) {
+    return queue_job((send_string_job_t){.source = SEND_STRING_SOURCE_EEPROM, .interval = interval, .address = (uintptr_t)string, .callback = callback, .cb_arg = cb_arg});
+}
+
+bool send_string_async_reader(send_string_async_reader_t reader, void *reader_arg, uint8_t interval, send_string_async_callback_t callback, void *cb_arg) {
+    return queue_job((send_string_job_t){.source = SEND_STRING_SOURCE_READER, .interval = interval, .address = (uintptr_t)reader_arg, .reader = reader, .callback = callback, .cb_arg = cb_arg});
+}
+
+bool send_string_async_is_busy(void) {
+    return job_count || token_active || action_index < action_count;
+}
+
+void send_string_async_cancel(void) {
+    // Release anything the current character still holds down
+    for (uint8_t i = action_index; i < action_count; ++i) {
+        for (uint8_t j = 0; j < action_index; ++j) {
+            if (!actions[i].pressed && actions[j].pressed && actions[j].keycode == actions[i].keycode) {
+                unregister_code(actions[i].keycode);
+                break;
+            }
+        }
+    }
+    action_count = 0;
+    action_index = 0;
+    timeout_cancel(TIMEOUT_SEND_STRING);
+    token_active = false;
+    job_head     = 0;
+    job_count    = 0;
+    buffer_head  = 0;
+    buffer_used  = 0;
 }
 #endif
@@ -23,6 +23,7 @@
  * \{
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "progmem.h"
@@ -151,4 +152,99 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 #define SEND_STRING_DELAY(string, interval) send_string_with_delay_P(PSTR(string), interval)
 
+#if defined(SEND_STRING_ASYNC_ENABLE) || defined(__DOXYGEN__)
+/**
+ * \brief Callback invoked once an asynchronously sent string has been typed out.
+ *
+ * \param cb_arg The argument passed when the string was queued.
+ */
+typedef void (*send_string_async_callback_t)(void *cb_arg);
+
+/**
+ * \brief Produces the string of send_string_async_reader() one byte at a time.
+ *
+ * \param reader_arg The argument passed when the string was queued.
+ * \param position The position of the byte to return. Positions are read in order, starting from 0 once the string is
+ * about to be typed.
+ * \return The byte at `position`, or 0 to end the string.
+ */
+typedef char (*send_string_async_reader_t)(void *reader_arg, uint16_t position);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out in the background.
+ *
+ * The string is copied, so it does not need to outlive the call. Characters are typed out one per main loop iteration
+ * at most, while the matrix keeps being scanned, and delays are waited out without blocking.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ * \param callback Called once the string has been typed out, may be `NULL`.
+ * \param cb_arg The argument to pass to the callback.
+ * \return `false` if the queue or its buffer is full, in which case nothing is typed.
+ */
+bool send_string_async(const char *string, uint8_t interval, send_string_async_callback_t callback, void *cb_arg);
+
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out in the background.
+ *
+ * The string is read in place rather than copied.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ * \param callback Called once the string has been typed out, may be `NULL`.
+ * \param cb_arg The argument to pass to the callback.
+ * \return `false` if the queue is full, in which case nothing is typed.
+ */
+bool send_string_async_P(const char *string, uint8_t interval, send_string_async_callback_t callback, void *cb_arg);
+
+/**
+ * \brief Queue a string of ASCII characters stored in EEPROM to be typed out in the background.
+ *
+ * The string is read in place rather than copied.
+ *
+ * \param string The EEPROM address of the string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ * \param callback Called once the string has been typed out, may be `NULL`.
+ * \param cb_arg The argument to pass to the callback.
+ * \return `false` if the queue is full, in which case nothing is typed.
+ */
+bool send_string_async_eeprom(const void *string, uint8_t interval, send_string_async_callback_t callback, void *cb_arg);
+
+/**
+ * \brief Queue a string that is produced on the fly to be typed out in the background.
+ *
+ * Nothing is read until the string is about to be typed, so it can be generated from the state at that time.
+ *
+ * \param reader Returns the bytes of the string, in the same format as the other Send String functions.
+ * \param reader_arg The argument to pass to the reader.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ * \param callback Called once the string has been typed out, may be `NULL`.
+ * \param cb_arg The argument to pass to the callback.
+ * \return `false` if the queue is full, in which case nothing is typed.
+ */
+bool send_string_async_reader(send_string_async_reader_t reader, void *reader_arg, uint8_t interval, send_string_async_callback_t callback, void *cb_arg);
+
+/**
+ * \brief Check whether any queued string is still being typed out.
+ */
+bool send_string_async_is_busy(void);
+
+/**
+ * \brief Drop every queued string without invoking their callbacks.
+ *
+ * Keys that are held down in the middle of typing a character are released.
+ */
+void send_string_async_cancel(void);
+
+/**
+ * \brief Types out the next character of the queued strings, called through the timeout service.
+ */
+void send_string_async_task(void);
+
+/**
+ * \brief Shortcut macro for send_string_async_P(PSTR(string), 0, NULL, NULL).
+ */
+#    define SEND_STRING_ASYNC(string) send_string_async_P(PSTR(string), 0, NULL, NULL)
+#endif
+
 /** \} */
@@ -21,6 +21,7 @@
 #include "quantum.h"
 #include "wait.h"
 #include "usb_util.h"
+#include "task_profiler.h"
 
 #ifdef EE_HANDS
 #    include "eeconfig.h"
@@ -239,7 +240,8 @@ bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t sl
     }
 #endif // SPLIT_MAX_CONNECTION_ERRORS > 0 && SPLIT_CONNECTION_CHECK_TIMEOUT > 0
 
-    __attribute__((unused)) bool okay = transport_master(master_matrix, slave_matrix);
+    __attribute__((unused)) bool okay;
+    TASK_PROFILE(TASK_PROFILER_SPLIT_TRANSACTIONS, okay = transport_master(master_matrix, slave_matrix));
 #if SPLIT_MAX_CONNECTION_ERRORS > 0
     if (!okay) {
         if (connection_errors < UINT8_MAX) {
@@ -0,0 +1,256 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "task_profiler.h"
+#include "timer.h"
+#include "print.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#elif defined(__AVR__)
+#    include <avr/io.h>
+#    include "timer_avr.h"
+#endif
+
+static task_profiler_stats_t  stats[TASK_PROFILER_COUNT];
+static task_profiler_sample_t ring[TASK_PROFILER_RING_SIZE];
+static uint8_t                ring_write = 0;
+static uint8_t                ring_count = 0;
+static uint32_t               events[TASK_PROFILER_EVENT_COUNT];
+
+// clang-format off
+static const char *const task_names[TASK_PROFILER_COUNT] = {
+    [TASK_PROFILER_KEYBOARD_TASK]        = "keyboard_task",
+    [TASK_PROFILER_MATRIX_TASK]          = "matrix_task",
+    [TASK_PROFILER_SPLIT_TRANSACTIONS]   = "split_transactions",
+    [TASK_PROFILER_QUANTUM_TASK]         = "quantum_task",
+    [TASK_PROFILER_SPLIT_WATCHDOG_TASK]  = "split_watchdog_task",
+    [TASK_PROFILER_RGBLIGHT_TASK]        = "rgblight_task",
+    [TASK_PROFILER_LED_MATRIX_TASK]      = "led_matrix_task",
+    [TASK_PROFILER_RGB_MATRIX_TASK]      = "rgb_matrix_task",
+    [TASK_PROFILER_BACKLIGHT_TASK]       = "backlight_task",
+    [TASK_PROFILER_ENCODER_READ]         = "encoder_read",
+    [TASK_PROFILER_POINTING_DEVICE_TASK] = "pointing_device_task",
+    [TASK_PROFILER_OLED_TASK]            = "oled_task",
+    [TASK_PROFILER_ST7565_TASK]          = "st7565_task",
+    [TASK_PROFILER_MOUSEKEY_TASK]        = "mousekey_task",
+    [TASK_PROFILER_PS2_MOUSE_TASK]       = "ps2_mouse_task",
+    [TASK_PROFILER_MIDI_TASK]            = "midi_task",
+    [TASK_PROFILER_VELOCIKEY_TASK]       = "velocikey_task",
+    [TASK_PROFILER_JOYSTICK_TASK]        = "joystick_task",
+    [TASK_PROFILER_BLUETOOTH_TASK]       = "bluetooth_task",
+    [TASK_PROFILER_LED_TASK]             = "led_task",
+    [TASK_PROFILER_PROTOCOL_TASK]        = "protocol_task",
+    [TASK_PROFILER_QUANTUM_PAINTER_TASK] = "qp_internal_task",
+    [TASK_PROFILER_DEFERRED_EXEC_TASK]   = "deferred_exec_task",
+    [TASK_PROFILER_HOUSEKEEPING_TASK]    = "housekeeping_task",
+    [TASK_PROFILER_USER]                 = "user",
+};
+
+static const char *const event_names[TASK_PROFILER_EVENT_COUNT] = {
+    [TASK_PROFILER_EVENT_WAITING_BUFFER_OVERFLOW]    = "waiting_buffer_overflow",
+    [TASK_PROFILER_EVENT_SYSTEM_REPORT_SUPPRESSED]   = "suppressed_system",
+    [TASK_PROFILER_EVENT_CONSUMER_REPORT_SUPPRESSED] = "suppressed_consumer",
+    [TASK_PROFILER_EVENT_REPORT_QUEUE_COALESCED]     = "report_queue_coalesced",
+    [TASK_PROFILER_EVENT_REPORT_QUEUE_DROPPED]       = "report_queue_dropped",
+};
+// clang-format on
+
+#if defined(PROTOCOL_CHIBIOS) && PORT_SUPPORTS_RT == TRUE
+__attribute__((weak)) uint32_t task_profiler_timestamp(void) {
+    return chSysGetRealtimeCounterX();
+}
+#elif defined(PROTOCOL_CHIBIOS)
+__attribute__((weak)) uint32_t task_profiler_timestamp(void) {
+    // No realtime counter on this port (e.g. Cortex-M0, RP2040)
+    return TIME_I2US(chVTGetSystemTimeX());
+}
+#elif defined(__AVR__)
+__attribute__((weak)) uint32_t task_profiler_timestamp(void) {
+    // Timer0 wraps every millisecond, so extend it with the millisecond counter
+    // and retry if the interrupt fired in between the two reads.
+    uint32_t ms;
+    uint8_t  raw;
+    do {
+        ms  = timer_read32();
+        raw = TIMER_RAW;
+    } while (ms != timer_read32());
+    return ms * (TIMER_RAW_TOP + 1) + raw;
+}
+#else
+__attribute__((weak)) uint32_t task_profiler_timestamp(void) {
+    return timer_read32();
+}
+#endif
+
+static uint8_t histogram_bucket(uint32_t duration) {
+    uint8_t bucket = 0;
+    while (duration && bucket < TASK_PROFILER_HISTOGRAM_BUCKETS - 1) {
+        duration >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+void task_profiler_record(task_profiler_id_t task, uint32_t duration) {
+    if (task >= TASK_PROFILER_COUNT) {
+        return;
+    }
+
+    task_profiler_stats_t *entry = &stats[task];
+    if (entry->count == 0 || duration < entry->min) {
+        entry->min = duration;
+    }
+    if (duration > entry->max) {
+        entry->max = duration;
+    }
+    // The buckets are 16 bits wide, stopping the count as well keeps them consistent with it
+    if (entry->count < UINT16_MAX) {
+        ++entry->count;
+        entry->total += duration;
+        ++entry->histogram[histogram_bucket(duration)];
+    }
+
+    ring[ring_write] = (task_profiler_sample_t){.task = task, .duration = duration};
+    ring_write       = (ring_write + 1) % TASK_PROFILER_RING_SIZE;
+    if (ring_count < TASK_PROFILER_RING_SIZE) {
+        ++ring_count;
+    }
+}
+
+void task_profiler_count_event(task_profiler_event_t event) {
+    if (event < TASK_PROFILER_EVENT_COUNT && events[event] < UINT32_MAX) {
+        ++events[event];
+    }
+}
+
+uint32_t task_profiler_get_event_count(task_profiler_event_t event) {
+    if (event >= TASK_PROFILER_EVENT_COUNT) {
+        return 0;
+    }
+    return events[event];
+}
+
+void task_profiler_reset(void) {
+    memset(stats, 0, sizeof(stats));
+    memset(events, 0, sizeof(events));
+    memset(ring, 0, sizeof(ring));
+    ring_write = 0;
+    ring_count = 0;
+}
+
+const task_profiler_stats_t *task_profiler_get_stats(task_profiler_id_t task) {
+    if (task >= TASK_PROFILER_COUNT) {
+        return NULL;
+    }
+    return &stats[task];
+}
+
+uint32_t task_profiler_percentile(task_profiler_id_t task, uint8_t percentile) {
+    if (task >= TASK_PROFILER_COUNT || stats[task].count == 0) {
+        return 0;
+    }
+
+    const task_profiler_stats_t *entry = &stats[task];
+
+    uint32_t samples = 0;
+    for (uint8_t i = 0; i < TASK_PROFILER_HISTOGRAM_BUCKETS; ++i) {
+        samples += entry->histogram[i];
+    }
+
+    // Rank of the requested percentile, rounded up so that p100 is the last sample
+    uint32_t rank       = (samples * percentile + 99) / 100;
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < TASK_PROFILER_HISTOGRAM_BUCKETS; ++i) {
+        cumulative += entry->histogram[i];
+        if (cumulative >= rank && cumulative > 0) {
+            // Bucket i holds durations below 2^i, the last bucket is unbounded
+            uint32_t upper = (i == 0) ? 0 : ((i < TASK_PROFILER_HISTOGRAM_BUCKETS - 1) ? ((1UL << i) - 1) : UINT32_MAX);
+            upper          = upper < entry->min ? entry->min : upper;
+            return upper > entry->max ? entry->max : upper;
+        }
+    }
+    return entry->max;
+}
+
+uint8_t task_profiler_recent_samples(task_profiler_sample_t *samples, uint8_t count) {
+    uint8_t copied = 0;
+    uint8_t index  = ring_write;
+    while (copied < count && copied < ring_count) {
+        index             = (index + TASK_PROFILER_RING_SIZE - 1) % TASK_PROFILER_RING_SIZE;
+        samples[copied++] = ring[index];
+    }
+    return copied;
+}
+
+const char *task_profiler_name(task_profiler_id_t task) {
+    if (task >= TASK_PROFILER_COUNT) {
+        return "unknown";
+    }
+    return task_names[task];
+}
+
+const char *task_profiler_event_name(task_profiler_event_t event) {
+    if (event >= TASK_PROFILER_EVENT_COUNT) {
+        return "unknown";
+    }
+    return event_names[event];
+}
+
+void task_profiler_print(void) {
+    uprintf("%-22s %10s %10s %10s %10s %10s %10s\n", "task", "count", "min", "avg", "p90", "p99", "max");
+    for (uint8_t i = 0; i < TASK_PROFILER_COUNT; ++i) {
+        const task_profiler_stats_t *entry = &stats[i];
+        if (entry->count == 0) {
+            continue;
+        }
+        uprintf("%-22s %10lu %10lu %10lu %10lu %10lu %10lu\n", task_names[i], (unsigned long)entry->count, (unsigned long)entry->min, (unsigned long)(entry->total / entry->count), (unsigned long)task_profiler_percentile(i, 90), (unsigned long)task_profiler_percentile(i, 99), (unsigned long)entry->max);
+    }
+    for (uint8_t i = 0; i < TASK_PROFILER_EVENT_COUNT; ++i) {
+        if (events[i] == 0) {
+            continue;
+        }
+        uprintf("%-22s %10lu\n", event_names[i], (unsigned long)events[i]);
+    }
+}
+
+static uint8_t serialize_u32(uint8_t *data, uint8_t offset, uint8_t length, uint32_t value) {
+    for (uint8_t i = 0; i < 4 && offset < length; ++i) {
+        data[offset++] = (value >> (i * 8)) & 0xFF;
+    }
+    return offset;
+}
+
+uint8_t task_profiler_serialize(task_profiler_id_t task, uint8_t *data, uint8_t length) {
+    if (task >= TASK_PROFILER_COUNT || length < 1) {
+        return 0;
+    }
+
+    const task_profiler_stats_t *entry  = &stats[task];
+    uint8_t                      offset = 0;
+
+    data[offset++] = task;
+    offset         = serialize_u32(data, offset, length, entry->count);
+    offset         = serialize_u32(data, offset, length, entry->min);
+    offset         = serialize_u32(data, offset, length, entry->max);
+    offset         = serialize_u32(data, offset, length, task_profiler_percentile(task, 50));
+    offset         = serialize_u32(data, offset, length, task_profiler_percentile(task, 90));
+    offset         = serialize_u32(data, offset, length, task_profiler_percentile(task, 99));
+    for (uint8_t i = 0; i < TASK_PROFILER_HISTOGRAM_BUCKETS && offset + 2 <= length; ++i) {
+        data[offset++] = entry->histogram[i] & 0xFF;
+        data[offset++] = entry->histogram[i] >> 8;
+    }
+    return offset;
+}
+
+void task_profiler_task(void) {
+#ifdef TASK_PROFILER_PRINT_INTERVAL
+    static uint32_t last_print = 0;
+    if (timer_elapsed32(last_print) >= TASK_PROFILER_PRINT_INTERVAL) {
+        last_print = timer_read32();
+        task_profiler_print();
+        task_profiler_reset();
+    }
+#endif
+}
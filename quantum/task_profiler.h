@@ -0,0 +1,191 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+    Per-task profiling of the main loop.
+
+    When TASK_PROFILER_ENABLE is set, every stage of keyboard_task() and the main
+    loop is timed automatically. Each stage keeps a count, min, max and a
+    log2-bucketed histogram of its duration, and the most recent samples of all
+    stages are kept in a fixed RAM ring. Results can be printed over console
+    with task_profiler_print() or sent over raw HID with task_profiler_serialize().
+
+    Durations are measured in ticks of task_profiler_timestamp(), which is the
+    realtime counter on ChibiOS ports that have one, the system time in
+    microseconds on other ChibiOS ports (e.g. Cortex-M0 and RP2040), Timer0 on
+    AVR and timer_read32() elsewhere. The function is weak, so the host tests
+    can provide a mocked clock.
+
+    The count, total and histogram of a stage stop at 65535 samples, so that
+    no histogram bucket can saturate on its own and skew the percentiles.
+    Min and max keep being updated. Reset the statistics to start over.
+
+    Rare events that are worth knowing about when looking into latency, such
+    as the tapping waiting buffer overflowing, are counted alongside and
+    listed below the table.
+
+    Wrapping additional code:
+
+        TASK_PROFILE(TASK_PROFILER_USER, {
+            my_expensive_task();
+        });
+*/
+
+#ifndef TASK_PROFILER_HISTOGRAM_BUCKETS
+#    define TASK_PROFILER_HISTOGRAM_BUCKETS 16
+#endif
+
+#ifndef TASK_PROFILER_RING_SIZE
+#    define TASK_PROFILER_RING_SIZE 32
+#endif
+
+typedef enum task_profiler_id_t {
+    TASK_PROFILER_KEYBOARD_TASK,
+    TASK_PROFILER_MATRIX_TASK,
+    TASK_PROFILER_SPLIT_TRANSACTIONS,
+    TASK_PROFILER_QUANTUM_TASK,
+    TASK_PROFILER_SPLIT_WATCHDOG_TASK,
+    TASK_PROFILER_RGBLIGHT_TASK,
+    TASK_PROFILER_LED_MATRIX_TASK,
+    TASK_PROFILER_RGB_MATRIX_TASK,
+    TASK_PROFILER_BACKLIGHT_TASK,
+    TASK_PROFILER_ENCODER_READ,
+    TASK_PROFILER_POINTING_DEVICE_TASK,
+    TASK_PROFILER_OLED_TASK,
+    TASK_PROFILER_ST7565_TASK,
+    TASK_PROFILER_MOUSEKEY_TASK,
+    TASK_PROFILER_PS2_MOUSE_TASK,
+    TASK_PROFILER_MIDI_TASK,
+    TASK_PROFILER_VELOCIKEY_TASK,
+    TASK_PROFILER_JOYSTICK_TASK,
+    TASK_PROFILER_BLUETOOTH_TASK,
+    TASK_PROFILER_LED_TASK,
+    TASK_PROFILER_PROTOCOL_TASK,
+    TASK_PROFILER_QUANTUM_PAINTER_TASK,
+    TASK_PROFILER_DEFERRED_EXEC_TASK,
+    TASK_PROFILER_HOUSEKEEPING_TASK,
+    TASK_PROFILER_USER,
+    TASK_PROFILER_COUNT,
+} task_profiler_id_t;
+
+typedef enum task_profiler_event_t {
+    TASK_PROFILER_EVENT_WAITING_BUFFER_OVERFLOW,
+    TASK_PROFILER_EVENT_SYSTEM_REPORT_SUPPRESSED,
+    TASK_PROFILER_EVENT_CONSUMER_REPORT_SUPPRESSED,
+    TASK_PROFILER_EVENT_REPORT_QUEUE_COALESCED,
+    TASK_PROFILER_EVENT_REPORT_QUEUE_DROPPED,
+    TASK_PROFILER_EVENT_COUNT,
+} task_profiler_event_t;
+
+typedef struct task_profiler_stats_t {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint16_t histogram[TASK_PROFILER_HISTOGRAM_BUCKETS];
+} task_profiler_stats_t;
+
+typedef struct task_profiler_sample_t {
+    uint8_t  task;
+    uint32_t duration;
+} task_profiler_sample_t;
+
+#ifdef TASK_PROFILER_ENABLE
+
+/**
+ * @brief Monotonic timestamp used for profiling, in platform specific ticks.
+ */
+uint32_t task_profiler_timestamp(void);
+
+/**
+ * @brief Records a single measured duration for the given task.
+ */
+void task_profiler_record(task_profiler_id_t task, uint32_t duration);
+
+/**
+ * @brief Counts one occurrence of the given event.
+ */
+void task_profiler_count_event(task_profiler_event_t event);
+
+/**
+ * @brief Returns the number of occurrences of the given event.
+ */
+uint32_t task_profiler_get_event_count(task_profiler_event_t event);
+
+/**
+ * @brief Clears all statistics, histograms, event counts and the sample ring.
+ */
+void task_profiler_reset(void);
+
+/**
+ * @brief Returns the accumulated statistics for the given task, or NULL if the task is out of range.
+ */
+const task_profiler_stats_t *task_profiler_get_stats(task_profiler_id_t task);
+
+/**
+ * @brief Returns an upper bound of the requested percentile (0-100) of durations for the given task.
+ *
+ * The bound is derived from the histogram, so it is exact to within one power of two.
+ */
+uint32_t task_profiler_percentile(task_profiler_id_t task, uint8_t percentile);
+
+/**
+ * @brief Copies up to `count` of the most recent samples, newest first.
+ *
+ * @return the number of samples copied
+ */
+uint8_t task_profiler_recent_samples(task_profiler_sample_t *samples, uint8_t count);
+
+/**
+ * @brief Returns a printable name for the given task.
+ */
+const char *task_profiler_name(task_profiler_id_t task);
+
+/**
+ * @brief Returns a printable name for the given event.
+ */
+const char *task_profiler_event_name(task_profiler_event_t event);
+
+/**
+ * @brief Prints a table of statistics for every task that has run, followed by every event that occurred.
+ */
+void task_profiler_print(void);
+
+/**
+ * @brief Packs the statistics of a task into a buffer, e.g. for a raw HID reply.
+ *
+ * Layout (little endian): task id, count (u32), min (u32), max (u32), p50 (u32),
+ * p90 (u32), p99 (u32) followed by as many u16 histogram buckets as fit.
+ *
+ * @return the number of bytes written
+ */
+uint8_t task_profiler_serialize(task_profiler_id_t task, uint8_t *data, uint8_t length);
+
+/**
+ * @brief Periodic housekeeping, prints the table every TASK_PROFILER_PRINT_INTERVAL milliseconds when defined.
+ */
+void task_profiler_task(void);
+
+#    define TASK_PROFILE(task, ...)                                                            \
+        do {                                                                                  \
+            uint32_t task_profiler_start_ts = task_profiler_timestamp();                      \
+            do {                                                                              \
+                __VA_ARGS__;                                                                  \
+            } while (0);                                                                      \
+            task_profiler_record((task), task_profiler_timestamp() - task_profiler_start_ts); \
+        } while (0)
+
+#else
+
+#    define TASK_PROFILE(task, ...) \
+        do {                        \
+            __VA_ARGS__;            \
+        } while (0)
+
+#    define task_profiler_count_event(event)
+
+#endif // TASK_PROFILER_ENABLE
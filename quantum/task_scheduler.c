@@ -0,0 +1,115 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "task_scheduler.h"
+#include "timer.h"
+#include "util.h"
+
+_Static_assert(TASK_SCHEDULER_COUNT <= 32, "task_scheduler bitmasks hold at most 32 tasks");
+
+static uint32_t now;
+static uint32_t next_due[TASK_SCHEDULER_COUNT];
+// Tasks that have been scheduled at least once, i.e. that are compiled in
+static uint32_t known_tasks = 0;
+// Tasks that must run on the next iteration regardless of their deadline
+static uint32_t woken_tasks = 0;
+
+static uint32_t last_matrix_scan = 0;
+static uint32_t task_started     = 0;
+static bool     task_running     = false;
+static uint16_t overruns[TASK_SCHEDULER_COUNT];
+// A scan in between tasks found a matrix change during this iteration
+static bool matrix_changed = false;
+
+void task_scheduler_begin(void) {
+    now            = timer_read32();
+    matrix_changed = false;
+}
+
+bool task_scheduler_is_due(task_scheduler_id_t task) {
+    const uint32_t mask = (1UL << task);
+    if (!(known_tasks & mask) || (woken_tasks & mask)) {
+        woken_tasks &= ~mask;
+        return true;
+    }
+    return timer_expired32(now, next_due[task]);
+}
+
+void task_scheduler_schedule(task_scheduler_id_t task, uint32_t delay_ms) {
+    known_tasks |= (1UL << task);
+    next_due[task] = now + delay_ms;
+}
+
+void task_scheduler_wake(task_scheduler_id_t task) {
+    woken_tasks |= (1UL << task);
+}
+
+uint32_t task_scheduler_next_deadline(void) {
+    if (woken_tasks) {
+        return 0;
+    }
+
+    const uint32_t current  = timer_read32();
+    uint32_t       earliest = UINT32_MAX;
+    for (uint8_t i = 0; i < TASK_SCHEDULER_COUNT; ++i) {
+        if (!(known_tasks & (1UL << i))) {
+            continue;
+        }
+        if (timer_expired32(current, next_due[i])) {
+            return 0;
+        }
+        earliest = MIN(earliest, TIMER_DIFF_32(next_due[i], current));
+    }
+    return earliest;
+}
+
+void task_scheduler_matrix_scanned(void) {
+    last_matrix_scan = timer_read32();
+}
+
+void task_scheduler_task_start(task_scheduler_id_t task) {
+    task_started = timer_read32();
+    task_running = true;
+}
+
+bool task_scheduler_task_end(task_scheduler_id_t task) {
+    task_running = false;
+
+    const uint32_t gap = timer_elapsed32(last_matrix_scan);
+    if (gap < TASK_SCHEDULER_MAX_MATRIX_GAP) {
+        return false;
+    }
+    if (gap > TASK_SCHEDULER_MAX_MATRIX_GAP && overruns[task] < UINT16_MAX) {
+        ++overruns[task];
+    }
+    if (!task_scheduler_service_matrix()) {
+        return false;
+    }
+    matrix_changed = true;
+    return true;
+}
+
+bool task_scheduler_matrix_changed(void) {
+    return matrix_changed;
+}
+
+bool task_scheduler_should_yield(void) {
+    if (!task_running) {
+        return false;
+    }
+
+    const uint32_t current = timer_read32();
+    return TIMER_DIFF_32(current, task_started) >= TASK_SCHEDULER_TASK_BUDGET || TIMER_DIFF_32(current, last_matrix_scan) >= TASK_SCHEDULER_MAX_MATRIX_GAP;
+}
+
+uint16_t task_scheduler_overruns(task_scheduler_id_t task) {
+    if (task >= TASK_SCHEDULER_COUNT) {
+        return 0;
+    }
+    return overruns[task];
+}
+
+void task_scheduler_reset_overruns(void) {
+    memset(overruns, 0, sizeof(overruns));
+}
@@ -0,0 +1,161 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+    Tickless scheduling of the main loop.
+
+    Without TASK_SCHEDULER_ENABLE every subsystem task is called on every
+    iteration of keyboard_task(). With it enabled, the matrix scan and encoder
+    reads still run on every iteration, while every other task declares after
+    how many milliseconds it next needs to run and is skipped until then. A task
+    can also be woken early, for example quantum_task() is woken whenever the
+    matrix changes.
+
+    The main loop therefore degrades to a tight matrix-scan loop whenever
+    nothing else is due. task_scheduler_next_deadline() reports how long that
+    is, so that keyboards with interrupt capable matrices can sleep through it.
+
+    Scheduled tasks also run against a time budget. After every scheduled task
+    the runner checks how long ago the matrix was last scanned and, once
+    TASK_SCHEDULER_MAX_MATRIX_GAP milliseconds have passed, scans it again
+    before moving on to the next task. A task that pushes the gap past that
+    bound is counted as an overrun. Long renderers call
+    task_scheduler_should_yield() between units of work and return early once
+    their TASK_SCHEDULER_TASK_BUDGET is spent, picking up where they left off
+    on their next run.
+
+    Declaring a scheduled task:
+
+        TASK_SCHEDULE(TASK_SCHEDULER_RGB_MATRIX, rgb_matrix_task_interval(), rgb_matrix_task());
+*/
+
+#ifndef TASK_SCHEDULER_DEFAULT_INTERVAL
+#    define TASK_SCHEDULER_DEFAULT_INTERVAL 1
+#endif
+
+#ifndef TASK_SCHEDULER_MAX_MATRIX_GAP
+#    define TASK_SCHEDULER_MAX_MATRIX_GAP 2
+#endif
+
+#ifndef TASK_SCHEDULER_TASK_BUDGET
+#    define TASK_SCHEDULER_TASK_BUDGET TASK_SCHEDULER_MAX_MATRIX_GAP
+#endif
+
+typedef enum task_scheduler_id_t {
+    TASK_SCHEDULER_QUANTUM,
+    TASK_SCHEDULER_RGBLIGHT,
+    TASK_SCHEDULER_LED_MATRIX,
+    TASK_SCHEDULER_RGB_MATRIX,
+    TASK_SCHEDULER_BACKLIGHT,
+    TASK_SCHEDULER_POINTING_DEVICE,
+    TASK_SCHEDULER_OLED,
+    TASK_SCHEDULER_ST7565,
+    TASK_SCHEDULER_MOUSEKEY,
+    TASK_SCHEDULER_PS2_MOUSE,
+    TASK_SCHEDULER_MIDI,
+    TASK_SCHEDULER_VELOCIKEY,
+    TASK_SCHEDULER_JOYSTICK,
+    TASK_SCHEDULER_BLUETOOTH,
+    TASK_SCHEDULER_LED,
+    TASK_SCHEDULER_QUANTUM_PAINTER,
+    TASK_SCHEDULER_DEFERRED_EXEC,
+    TASK_SCHEDULER_COUNT,
+} task_scheduler_id_t;
+
+#ifdef TASK_SCHEDULER_ENABLE
+
+/**
+ * @brief Latches the current time for all due checks of one main loop iteration.
+ */
+void task_scheduler_begin(void);
+
+/**
+ * @brief Returns true if the task's deadline has passed or it has been woken.
+ */
+bool task_scheduler_is_due(task_scheduler_id_t task);
+
+/**
+ * @brief Sets the task's next deadline `delay_ms` milliseconds from now, 0 runs it on the next iteration.
+ */
+void task_scheduler_schedule(task_scheduler_id_t task, uint32_t delay_ms);
+
+/**
+ * @brief Runs the task on the next iteration regardless of its deadline.
+ */
+void task_scheduler_wake(task_scheduler_id_t task);
+
+/**
+ * @brief Returns the number of milliseconds until the earliest task is due, 0 if any task is due now.
+ */
+uint32_t task_scheduler_next_deadline(void);
+
+/**
+ * @brief Records that the matrix has just been scanned.
+ */
+void task_scheduler_matrix_scanned(void);
+
+/**
+ * @brief Starts the budget of a scheduled task.
+ */
+void task_scheduler_task_start(task_scheduler_id_t task);
+
+/**
+ * @brief Ends the budget of a scheduled task, scanning the matrix if it is overdue.
+ *
+ * @return true if that scan found a matrix change
+ */
+bool task_scheduler_task_end(task_scheduler_id_t task);
+
+/**
+ * @brief Returns true if a scan in between scheduled tasks found a matrix change during this main loop iteration.
+ */
+bool task_scheduler_matrix_changed(void);
+
+/**
+ * @brief Returns true if the running task has spent its budget or the matrix is due for a scan.
+ *
+ * Always false outside of a scheduled task.
+ */
+bool task_scheduler_should_yield(void);
+
+/**
+ * @brief Returns the number of times the given task pushed the gap between matrix scans past TASK_SCHEDULER_MAX_MATRIX_GAP.
+ */
+uint16_t task_scheduler_overruns(task_scheduler_id_t task);
+
+/**
+ * @brief Clears all overrun counters.
+ */
+void task_scheduler_reset_overruns(void);
+
+/**
+ * @brief Scans the matrix in between scheduled tasks, implemented by keyboard.c.
+ *
+ * @return true if the matrix changed
+ */
+bool task_scheduler_service_matrix(void);
+
+#    define TASK_SCHEDULE(task, interval, ...)           \
+        do {                                             \
+            if (task_scheduler_is_due(task)) {           \
+                task_scheduler_task_start(task);         \
+                __VA_ARGS__;                             \
+                task_scheduler_schedule(task, interval); \
+                task_scheduler_task_end(task);           \
+            }                                            \
+        } while (0)
+
+#else
+
+#    define TASK_SCHEDULE(task, interval, ...) \
+        do {                                   \
+            __VA_ARGS__;                       \
+        } while (0)
+
+#    define task_scheduler_should_yield() false
+
+#endif // TASK_SCHEDULER_ENABLE
@@ -0,0 +1,107 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "timeout.h"
+#include "timer.h"
+#include "util.h"
+
+_Static_assert(TIMEOUT_COUNT <= 16, "timeout bitmasks hold at most 16 timeouts");
+
+static uint32_t           deadlines[TIMEOUT_COUNT];
+static timeout_callback_t callbacks[TIMEOUT_COUNT];
+static uint16_t           pending_timeouts = 0;
+// No pending timeout expires before this, so timeout_task() can return early
+static uint32_t earliest_deadline = 0;
+static uint16_t lateness[TIMEOUT_COUNT];
+
+static inline bool deadline_before(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) < 0;
+}
+
+static void update_earliest_deadline(void) {
+    bool found = false;
+    for (uint8_t i = 0; i < TIMEOUT_COUNT; ++i) {
+        if ((pending_timeouts & (1U << i)) && (!found || deadline_before(deadlines[i], earliest_deadline))) {
+            earliest_deadline = deadlines[i];
+            found             = true;
+        }
+    }
+}
+
+void timeout_start(timeout_id_t id, uint32_t delay_ms, timeout_callback_t callback) {
+    const uint32_t deadline = timer_read32() + delay_ms;
+
+    if (!pending_timeouts || deadline_before(deadline, earliest_deadline)) {
+        earliest_deadline = deadline;
+    }
+    deadlines[id] = deadline;
+    callbacks[id] = callback;
+    pending_timeouts |= (1U << id);
+}
+
+void timeout_cancel(timeout_id_t id) {
+    // The early out deadline may now be too early, which only costs one extra look at the pending timeouts
+    pending_timeouts &= ~(1U << id);
+}
+
+bool timeout_is_pending(timeout_id_t id) {
+    return pending_timeouts & (1U << id);
+}
+
+uint32_t timeout_next_deadline(void) {
+    if (!pending_timeouts) {
+        return UINT32_MAX;
+    }
+
+    update_earliest_deadline();
+    const uint32_t now = timer_read32();
+    return timer_expired32(now, earliest_deadline) ? 0 : TIMER_DIFF_32(earliest_deadline, now);
+}
+
+void timeout_task(void) {
+    if (!pending_timeouts) {
+        return;
+    }
+
+    const uint32_t now = timer_read32();
+    if (!timer_expired32(now, earliest_deadline)) {
+        return;
+    }
+
+    uint16_t serviced = 0;
+    while (true) {
+        // Pick the expired timeout with the earliest deadline, the first declared one on ties
+        int8_t next = -1;
+        for (uint8_t i = 0; i < TIMEOUT_COUNT; ++i) {
+            const uint16_t mask = (1U << i);
+            if (!(pending_timeouts & mask) || (serviced & mask) || !timer_expired32(now, deadlines[i])) {
+                continue;
+            }
+            if (next < 0 || deadline_before(deadlines[i], deadlines[next])) {
+                next = i;
+            }
+        }
+        if (next < 0) {
+            break;
+        }
+
+        pending_timeouts &= ~(1U << next);
+        serviced |= (1U << next);
+        lateness[next] = MAX(lateness[next], (uint16_t)MIN(TIMER_DIFF_32(now, deadlines[next]), UINT16_MAX));
+        callbacks[next]();
+    }
+
+    update_earliest_deadline();
+}
+
+uint16_t timeout_max_lateness(timeout_id_t id) {
+    if (id >= TIMEOUT_COUNT) {
+        return 0;
+    }
+    return lateness[id];
+}
+
+void timeout_reset_lateness(void) {
+    memset(lateness, 0, sizeof(lateness));
+}
@@ -0,0 +1,73 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+    Core feature timeouts.
+
+    Features that need to act once some time has passed without further input
+    (the tap dance term, the combo term, leader and Caps Word timeouts, ...)
+    arm a timeout here instead of polling their own timer on every iteration of
+    quantum_task(). timeout_task() then only calls back into a feature once its
+    timeout has expired, and does nothing at all while none has.
+
+    Expired timeouts are serviced in order of their deadline, timeouts expiring
+    at the same time in the order they are declared in timeout_id_t. Every
+    timeout is serviced at most once per timeout_task(), so a callback that
+    re-arms its own timeout runs again on the next iteration at the earliest.
+
+    Arming a timeout that is already pending moves its deadline.
+
+        timeout_start(TIMEOUT_CAPS_WORD, CAPS_WORD_IDLE_TIMEOUT, caps_word_task);
+*/
+
+typedef enum timeout_id_t {
+    TIMEOUT_KEY_OVERRIDE,
+    TIMEOUT_TAP_DANCE,
+    TIMEOUT_COMBO,
+    TIMEOUT_LEADER,
+    TIMEOUT_AUTO_SHIFT,
+    TIMEOUT_CAPS_WORD,
+    TIMEOUT_SEND_STRING,
+    TIMEOUT_COUNT,
+} timeout_id_t;
+
+typedef void (*timeout_callback_t)(void);
+
+/**
+ * @brief Arms the timeout to call `callback` once `delay_ms` milliseconds have passed, 0 calls it on the next timeout_task().
+ */
+void timeout_start(timeout_id_t id, uint32_t delay_ms, timeout_callback_t callback);
+
+/**
+ * @brief Disarms the timeout, nothing happens if it is not pending.
+ */
+void timeout_cancel(timeout_id_t id);
+
+/**
+ * @brief Returns true if the timeout is armed and its callback has not been called yet.
+ */
+bool timeout_is_pending(timeout_id_t id);
+
+/**
+ * @brief Returns the number of milliseconds until the earliest timeout expires, 0 if one already has, UINT32_MAX if none are pending.
+ */
+uint32_t timeout_next_deadline(void);
+
+/**
+ * @brief Calls back every expired timeout, called from quantum_task().
+ */
+void timeout_task(void);
+
+/**
+ * @brief Returns the largest number of milliseconds the timeout's callback was called after its deadline.
+ */
+uint16_t timeout_max_lateness(timeout_id_t id);
+
+/**
+ * @brief Clears all lateness statistics.
+ */
+void timeout_reset_lateness(void);
@@ -230,6 +230,7 @@ __attribute__((weak)) void unicode_input_start(void) {
                 tap_code(KC_NUM_LOCK);
             }
             register_code(KC_LEFT_ALT);
+            keyboard_report_batch_flush();
             wait_ms(UNICODE_TYPE_DELAY);
             tap_code(KC_KP_PLUS);
             break;
@@ -245,6 +246,7 @@ __attribute__((weak)) void unicode_input_start(void) {
             break;
     }
 
+    keyboard_report_batch_flush();
     wait_ms(UNICODE_TYPE_DELAY);
 }
 
@@ -384,3 +386,275 @@ void send_unicode_string(const char *str) {
         }
     }
 }
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include <string.h>
+#    include "progmem.h"
+
+/* Unicode input as Send String programs, typed through send_string_async_reader().
+ *
+ * The sequences that start and finish a code point only depend on the input
+ * mode, so they are built once per mode. Typing a code point then only adds
+ * the lock key handling and the hex digits around them.
+ */
+static uint8_t compiled_mode = UNICODE_MODE_COUNT;
+static char    program_start[40];
+static uint8_t program_start_length;
+static char    program_finish[8];
+static uint8_t program_finish_length;
+
+/* The program of the code point being typed, and the position read from it.
+ * Large enough for the released modifiers, the lock keys, the start and finish
+ * sequences, and eight hex digits that each need Shift, AltGr and a dead key. */
+static char        program[228];
+static uint8_t     program_length;
+static uint8_t     program_index;
+static const char *program_string;
+// The modifiers released at the start of the program, pressed again at its end if they are still held
+static uint8_t program_mods;
+
+static uint8_t append_code(char *dest, uint8_t length, uint8_t code, uint8_t keycode) {
+    dest[length++] = SS_QMK_PREFIX;
+    dest[length++] = code;
+    dest[length++] = keycode;
+    return length;
+}
+
+static uint8_t append_mods(char *dest, uint8_t length, uint8_t code, uint8_t mods) {
+    for (uint8_t i = 0; i < 8; i++) {
+        if (mods & (1 << i)) {
+            length = append_code(dest, length, code, KC_LEFT_CTRL + i);
+        }
+    }
+    return length;
+}
+
+// Mirrors tap_code16(): the modifiers of the keycode are held around the tap
+static uint8_t append_tap16(char *dest, uint8_t length, uint16_t keycode) {
+    uint8_t mods = QK_MODS_GET_MODS(keycode);
+    mods         = (mods & 0x10) ? (mods & 0x0F) << 4 : mods;
+    length       = append_mods(dest, length, SS_DOWN_CODE, mods);
+    length       = append_code(dest, length, SS_TAP_CODE, QK_MODS_GET_BASIC_KEYCODE(keycode));
+    return append_mods(dest, length, SS_UP_CODE, mods);
+}
+
+static uint8_t append_delay(char *dest, uint8_t length, uint16_t ms) {
+    char   digits[5];
+    int8_t count = 0;
+    do {
+        digits[count++] = '0' + ms % 10;
+        ms /= 10;
+    } while (ms);
+
+    dest[length++] = SS_QMK_PREFIX;
+    dest[length++] = SS_DELAY_CODE;
+    while (count) {
+        dest[length++] = digits[--count];
+    }
+    dest[length++] = '|';
+    return length;
+}
+
+#    define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
+
+/* Mirrors send_nibble_wrapper(). Outside of Windows mode the digit is resolved
+ * through the Send String lookup tables here, as send_nibble() does through
+ * send_char(), so that both type the same keys on any Send String layout. */
+static uint8_t append_nibble(char *dest, uint8_t length, uint8_t digit) {
+    if (compiled_mode == UNICODE_MODE_WINDOWS) {
+        return append_code(dest, length, SS_TAP_CODE, digit < 10 ? KC_KP_1 + (10 + digit - 1) % 10 : KC_A + (digit - 10));
+    }
+
+    uint8_t ascii_code = digit < 10 ? '0' + digit : 'a' + (digit - 10);
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, ascii_code);
+
+    if (is_shifted) {
+        length = append_code(dest, length, SS_DOWN_CODE, KC_LEFT_SHIFT);
+    }
+    if (is_altgred) {
+        length = append_code(dest, length, SS_DOWN_CODE, KC_RIGHT_ALT);
+    }
+    length = append_code(dest, length, SS_TAP_CODE, keycode);
+    if (is_altgred) {
+        length = append_code(dest, length, SS_UP_CODE, KC_RIGHT_ALT);
+    }
+    if (is_shifted) {
+        length = append_code(dest, length, SS_UP_CODE, KC_LEFT_SHIFT);
+    }
+    if (is_dead) {
+        length = append_code(dest, length, SS_TAP_CODE, KC_SPACE);
+    }
+    return length;
+}
+
+// Mirrors register_hex32()
+static uint8_t append_hex32(char *dest, uint8_t length, uint32_t hex) {
+    bool first_digit        = true;
+    bool needs_leading_zero = (compiled_mode == UNICODE_MODE_WINCOMPOSE);
+    for (int i = 7; i >= 0; i--) {
+        uint8_t digit = ((hex >> (i * 4)) & 0xF);
+        if (first_digit && needs_leading_zero && digit > 9) {
+            length = append_nibble(dest, length, 0);
+        }
+        if (digit != 0 || !first_digit || i < 4) {
+            length      = append_nibble(dest, length, digit);
+            first_digit = false;
+        }
+    }
+    return length;
+}
+
+// Mirrors unicode_input_start() and unicode_input_finish(), apart from the lock keys
+static void compile_mode(uint8_t mode) {
+    compiled_mode         = mode;
+    program_start_length  = 0;
+    program_finish_length = 0;
+
+    switch (mode) {
+        case UNICODE_MODE_MACOS:
+            program_start_length  = append_code(program_start, program_start_length, SS_DOWN_CODE, UNICODE_KEY_MAC);
+            program_finish_length = append_code(program_finish, program_finish_length, SS_UP_CODE, UNICODE_KEY_MAC);
+            break;
+        case UNICODE_MODE_LINUX:
+            program_start_length  = append_tap16(program_start, program_start_length, UNICODE_KEY_LNX);
+            program_finish_length = append_code(program_finish, program_finish_length, SS_TAP_CODE, KC_SPACE);
+            break;
+        case UNICODE_MODE_WINDOWS:
+            program_start_length  = append_code(program_start, program_start_length, SS_DOWN_CODE, KC_LEFT_ALT);
+            program_start_length  = append_delay(program_start, program_start_length, UNICODE_TYPE_DELAY);
+            program_start_length  = append_code(program_start, program_start_length, SS_TAP_CODE, KC_KP_PLUS);
+            program_finish_length = append_code(program_finish, program_finish_length, SS_UP_CODE, KC_LEFT_ALT);
+            break;
+        case UNICODE_MODE_WINCOMPOSE:
+            program_start_length  = append_code(program_start, program_start_length, SS_TAP_CODE, UNICODE_KEY_WINC);
+            program_start_length  = append_code(program_start, program_start_length, SS_TAP_CODE, KC_U);
+            program_finish_length = append_code(program_finish, program_finish_length, SS_TAP_CODE, KC_ENTER);
+            break;
+        case UNICODE_MODE_EMACS:
+            program_start_length  = append_tap16(program_start, program_start_length, LCTL(KC_X));
+            program_start_length  = append_code(program_start, program_start_length, SS_TAP_CODE, KC_8);
+            program_start_length  = append_code(program_start, program_start_length, SS_TAP_CODE, KC_ENTER);
+            program_finish_length = append_code(program_finish, program_finish_length, SS_TAP_CODE, KC_ENTER);
+            break;
+    }
+    program_start_length = append_delay(program_start, program_start_length, UNICODE_TYPE_DELAY);
+}
+
+/* Appends the program typing one code point, mirroring register_unicode().
+ * Code points the input mode cannot type add nothing. */
+static void compile_code_point(uint32_t code_point) {
+    if (compiled_mode != unicode_config.input_mode) {
+        compile_mode(unicode_config.input_mode);
+    }
+    if (code_point > 0x10FFFF || (code_point > 0xFFFF && compiled_mode == UNICODE_MODE_WINDOWS)) {
+        return;
+    }
+
+    led_t led_state   = host_keyboard_led_state();
+    bool  toggle_caps = compiled_mode == UNICODE_MODE_LINUX && led_state.caps_lock;
+    bool  toggle_num  = compiled_mode == UNICODE_MODE_WINDOWS && !led_state.num_lock;
+
+    if (toggle_caps) {
+        program_length = append_code(program, program_length, SS_TAP_CODE, KC_CAPS_LOCK);
+    }
+    if (toggle_num) {
+        program_length = append_code(program, program_length, SS_TAP_CODE, KC_NUM_LOCK);
+    }
+    memcpy(program + program_length, program_start, program_start_length);
+    program_length += program_start_length;
+
+    if (code_point > 0xFFFF && compiled_mode == UNICODE_MODE_MACOS) {
+        // Convert code point to UTF-16 surrogate pair on macOS
+        code_point -= 0x10000;
+        program_length = append_hex32(program, program_length, ((code_point & 0xFFC00) >> 10) + 0xD800);
+        program_length = append_hex32(program, program_length, (code_point & 0x3FF) + 0xDC00);
+    } else {
+        program_length = append_hex32(program, program_length, code_point);
+    }
+
+    memcpy(program + program_length, program_finish, program_finish_length);
+    program_length += program_finish_length;
+    if (toggle_caps) {
+        program_length = append_code(program, program_length, SS_TAP_CODE, KC_CAPS_LOCK);
+    }
+    if (toggle_num) {
+        program_length = append_code(program, program_length, SS_TAP_CODE, KC_NUM_LOCK);
+    }
+}
+
+/* Held modifiers would turn the hex digits into other characters, so they are
+ * released first, and pressed again once everything has been typed, as
+ * unicode_input_start() and unicode_input_finish() do. */
+static void start_program(void) {
+    program_index  = 0;
+    program_mods   = get_mods();
+    program_length = append_mods(program, 0, SS_UP_CODE, program_mods);
+}
+
+static char read_program(void) {
+    if (program_index == program_length && program_mods) {
+        program_index  = 0;
+        program_length = append_mods(program, 0, SS_DOWN_CODE, program_mods);
+        program_mods   = 0;
+    }
+    return program_index < program_length ? program[program_index++] : 0;
+}
+
+/* Called by process_unicode_common() for every key release, so that a
+ * modifier released while the program is typing is not pressed again. */
+void unicode_async_key_released(uint16_t keycode) {
+    uint8_t mods = 0;
+    if (IS_MODIFIER_KEYCODE(keycode)) {
+        mods = MOD_BIT(keycode);
+    } else {
+        if (IS_QK_MODS(keycode)) {
+            mods = QK_MODS_GET_MODS(keycode);
+        } else if (IS_QK_MOD_TAP(keycode)) {
+            mods = QK_MOD_TAP_GET_MODS(keycode);
+        } else if (IS_QK_LAYER_MOD(keycode)) {
+            mods = QK_LAYER_MOD_GET_MODS(keycode);
+        }
+        mods = (mods & 0x10) ? (mods & 0x0F) << 4 : mods;
+    }
+    program_mods &= ~mods;
+}
+
+static char read_unicode_string(void *reader_arg, uint16_t position) {
+    if (position == 0) {
+        program_string = reader_arg;
+        start_program();
+    }
+    while (program_index == program_length && *program_string) {
+        int32_t code_point = 0;
+        program_string     = decode_utf8(program_string, &code_point);
+        program_index      = 0;
+        program_length     = 0;
+        if (code_point >= 0) {
+            compile_code_point(code_point);
+        }
+    }
+    return read_program();
+}
+
+static char read_code_point(void *reader_arg, uint16_t position) {
+    if (position == 0) {
+        start_program();
+        compile_code_point((uintptr_t)reader_arg);
+    }
+    return read_program();
+}
+
+bool register_unicode_async(uint32_t code_point) {
+    return send_string_async_reader(read_code_point, (void *)(uintptr_t)code_point, 0, NULL, NULL);
+}
+
+bool send_unicode_string_async(const char *str) {
+    if (!str) {
+        return false;
+    }
+    return send_string_async_reader(read_unicode_string, (void *)str, 0, NULL, NULL);
+}
+#endif
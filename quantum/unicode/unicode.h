@@ -61,6 +61,12 @@ void register_unicode(uint32_t code_point);
 
 void send_unicode_string(const char *str);
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+bool register_unicode_async(uint32_t code_point);
+bool send_unicode_string_async(const char *str);
+void unicode_async_key_released(uint16_t keycode);
+#endif
+
 // clang-format off
 
 #define UC_BSPC UC(0x0008) // (backspace)
@@ -0,0 +1,174 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Autocorrection dictionary (70 entries):
+//   :guage     -> gauge
+//   :the:the:  -> the
+//   :thier     -> their
+//   :ture      -> true
+//   accomodate -> accommodate
+//   acommodate -> accommodate
+//   aparent    -> apparent
+//   aparrent   -> apparent
+//   apparant   -> apparent
+//   apparrent  -> apparent
+//   aquire     -> acquire
+//   becuase    -> because
+//   cauhgt     -> caught
+//   cheif      -> chief
+//   choosen    -> chosen
+//   cieling    -> ceiling
+//   collegue   -> colleague
+//   concensus  -> consensus
+//   contians   -> contains
+//   cosnt      -> const
+//   dervied    -> derived
+//   fales      -> false
+//   fasle      -> false
+//   fitler     -> filter
+//   flase      -> false
+//   foward     -> forward
+//   frequecy   -> frequency
+//   gaurantee  -> guarantee
+//   guaratee   -> guarantee
+//   heigth     -> height
+//   heirarchy  -> hierarchy
+//   inclued    -> include
+//   interator  -> iterator
+//   intput     -> input
+//   invliad    -> invalid
+//   lenght     -> length
+//   liasion    -> liaison
+//   libary     -> library
+//   listner    -> listener
+//   looses:    -> loses
+//   looup      -> lookup
+//   manefist   -> manifest
+//   namesapce  -> namespace
+//   namespcae  -> namespace
+//   occassion  -> occasion
+//   occured    -> occurred
+//   ouptut     -> output
+//   ouput      -> output
+//   overide    -> override
+//   postion    -> position
+//   priviledge -> privilege
+//   psuedo     -> pseudo
+//   recieve    -> receive
+//   refered    -> referred
+//   relevent   -> relevant
+//   repitition -> repetition
+//   retrun     -> return
+//   retun      -> return
+//   reuslt     -> result
+//   reutrn     -> return
+//   saftey     -> safety
+//   seperate   -> separate
+//   singed     -> signed
+//   stirng     -> string
+//   strign     -> string
+//   swithc     -> switch
+//   swtich     -> switch
+//   thresold   -> threshold
+//   udpate     -> update
+//   widht      -> width
+
+#define AUTOCORRECT_MIN_LENGTH 5 // ":ture"
+#define AUTOCORRECT_MAX_LENGTH 10 // "accomodate"
+#define AUTOCORRECT_DOUBLE_ARRAY_SIZE 124
+#define AUTOCORRECT_CORRECTIONS_SIZE 758
+#define AUTOCORRECT_LEAF 0x8000
+
+static const uint16_t autocorrect_base[AUTOCORRECT_DOUBLE_ARRAY_SIZE] PROGMEM = {
+    0, 0, 76, 32768, 12, 28, 32778, 7, 6, 32920, 86, 93, 72, 32810, 36, 32788, 32800, 59, 22, 31,
+    48, 63, 64, 88, 32822, 56, 32931, 70, 34, 32847, 32835, 32860, 32874, 2, 73, 69, 32988, 32971,
+    33307, 33111, 32886, 32940, 33227, 32951, 33236, 32996, 54, 1, 9, 32895, 32908, 3, 33009, 33121,
+    32960, 33025, 79, 24, 33428, 33060, 33035, 33072, 84, 33184, 33082, 33335, 33132, 33046, 33142,
+    18, 33162, 33317, 33204, 33172, 33100, 33196, 33437, 66, 33346, 33243, 33153, 33217, 33252,
+    33273, 33262, 33288, 33280, 33326, 33362, 77, 8, 57, 87, 33412, 33420, 97, 33447, 33370, 33472,
+    33402, 0, 92, 33380, 33299, 33390, 33483, 33462, 33498, 33510, 107, 0, 0, 0, 0, 0, 10, 0, 0, 0,
+    0, 0, 0, 0, 33519
+};
+
+static const uint8_t autocorrect_check[AUTOCORRECT_DOUBLE_ARRAY_SIZE] PROGMEM = {
+    0, 0, 1, 3, 4, 5, 6, 7, 8, 3, 1, 1, 9, 1, 14, 15, 16, 5, 18, 19, 20, 14, 20, 15, 12, 25, 20, 5,
+    28, 1, 18, 3, 4, 5, 16, 7, 5, 15, 20, 5, 12, 5, 18, 7, 20, 14, 18, 19, 20, 21, 22, 15, 21, 19,
+    18, 7, 8, 21, 1, 3, 12, 5, 14, 9, 8, 1, 7, 19, 9, 21, 1, 5, 9, 4, 18, 21, 19, 18, 14, 9, 21, 18,
+    12, 4, 14, 1, 7, 21, 12, 5, 4, 19, 20, 20, 21, 18, 9, 21, 1, 22, 0, 13, 16, 19, 18, 13, 19, 15,
+    1, 16, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 16
+};
+
+static const uint8_t autocorrect_corrections[AUTOCORRECT_CORRECTIONS_SIZE] PROGMEM = {
+    0x05, 0x08, 0x14, 0x09, 0x17, 0x13, 0x81, 0x63, 0x68, 0x00, 0x04, 0x09, 0x05, 0x08, 0x03, 0x82,
+    0x69, 0x65, 0x66, 0x00, 0x05, 0x04, 0x05, 0x15, 0x13, 0x10, 0x83, 0x65, 0x75, 0x64, 0x6F, 0x00,
+    0x04, 0x15, 0x0F, 0x0F, 0x0C, 0x81, 0x6B, 0x75, 0x70, 0x00, 0x05, 0x09, 0x0C, 0x16, 0x0E, 0x09,
+    0x83, 0x61, 0x6C, 0x69, 0x64, 0x00, 0x06, 0x0F, 0x13, 0x05, 0x12, 0x08, 0x14, 0x82, 0x68, 0x6F,
+    0x6C, 0x64, 0x00, 0x04, 0x01, 0x17, 0x0F, 0x06, 0x83, 0x72, 0x77, 0x61, 0x72, 0x64, 0x00, 0x07,
+    0x03, 0x10, 0x13, 0x05, 0x0D, 0x01, 0x0E, 0x82, 0x61, 0x63, 0x65, 0x00, 0x07, 0x10, 0x01, 0x13,
+    0x05, 0x0D, 0x01, 0x0E, 0x83, 0x70, 0x61, 0x63, 0x65, 0x00, 0x05, 0x09, 0x12, 0x05, 0x16, 0x0F,
+    0x82, 0x72, 0x69, 0x64, 0x65, 0x00, 0x03, 0x13, 0x01, 0x06, 0x82, 0x6C, 0x73, 0x65, 0x00, 0x06,
+    0x07, 0x05, 0x0C, 0x0C, 0x0F, 0x03, 0x82, 0x61, 0x67, 0x75, 0x65, 0x00, 0x05, 0x05, 0x09, 0x03,
+    0x05, 0x12, 0x83, 0x65, 0x69, 0x76, 0x65, 0x00, 0x04, 0x09, 0x14, 0x17, 0x13, 0x83, 0x69, 0x74,
+    0x63, 0x68, 0x00, 0x04, 0x07, 0x09, 0x05, 0x08, 0x81, 0x68, 0x74, 0x00, 0x05, 0x13, 0x0F, 0x0F,
+    0x08, 0x03, 0x83, 0x73, 0x65, 0x6E, 0x00, 0x04, 0x09, 0x12, 0x14, 0x13, 0x81, 0x6E, 0x67, 0x00,
+    0x04, 0x14, 0x15, 0x05, 0x12, 0x83, 0x74, 0x75, 0x72, 0x6E, 0x00, 0x07, 0x14, 0x01, 0x12, 0x05,
+    0x14, 0x0E, 0x09, 0x87, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x03, 0x0C, 0x01, 0x06,
+    0x81, 0x73, 0x65, 0x00, 0x06, 0x01, 0x09, 0x14, 0x0E, 0x0F, 0x03, 0x83, 0x61, 0x69, 0x6E, 0x73,
+    0x00, 0x07, 0x13, 0x0E, 0x05, 0x03, 0x0E, 0x0F, 0x03, 0x85, 0x73, 0x65, 0x6E, 0x73, 0x75, 0x73,
+    0x00, 0x04, 0x08, 0x15, 0x01, 0x03, 0x82, 0x67, 0x68, 0x74, 0x00, 0x04, 0x13, 0x15, 0x05, 0x12,
+    0x83, 0x73, 0x75, 0x6C, 0x74, 0x00, 0x06, 0x09, 0x06, 0x05, 0x0E, 0x01, 0x0D, 0x84, 0x69, 0x66,
+    0x65, 0x73, 0x74, 0x00, 0x06, 0x05, 0x15, 0x11, 0x05, 0x12, 0x06, 0x81, 0x6E, 0x63, 0x79, 0x00,
+    0x04, 0x14, 0x06, 0x01, 0x13, 0x82, 0x65, 0x74, 0x79, 0x00, 0x07, 0x03, 0x12, 0x01, 0x12, 0x09,
+    0x05, 0x08, 0x87, 0x69, 0x65, 0x72, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00, 0x04, 0x01, 0x02, 0x09,
+    0x0C, 0x82, 0x72, 0x61, 0x72, 0x79, 0x00, 0x07, 0x08, 0x14, 0x1C, 0x05, 0x08, 0x14, 0x1C, 0x84,
+    0x00, 0x05, 0x05, 0x13, 0x0F, 0x0F, 0x0C, 0x84, 0x73, 0x65, 0x73, 0x00, 0x03, 0x0E, 0x09, 0x13,
+    0x83, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x04, 0x16, 0x12, 0x05, 0x04, 0x83, 0x69, 0x76, 0x65, 0x64,
+    0x00, 0x04, 0x0C, 0x03, 0x0E, 0x09, 0x81, 0x64, 0x65, 0x00, 0x03, 0x15, 0x07, 0x1C, 0x83, 0x61,
+    0x75, 0x67, 0x65, 0x00, 0x07, 0x05, 0x0C, 0x09, 0x16, 0x09, 0x12, 0x10, 0x82, 0x67, 0x65, 0x00,
+    0x03, 0x15, 0x11, 0x01, 0x84, 0x63, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x02, 0x14, 0x1C, 0x82,
+    0x72, 0x75, 0x65, 0x00, 0x04, 0x0C, 0x05, 0x09, 0x03, 0x85, 0x65, 0x69, 0x6C, 0x69, 0x6E, 0x67,
+    0x00, 0x03, 0x09, 0x14, 0x13, 0x83, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x03, 0x14, 0x05, 0x12, 0x82,
+    0x75, 0x72, 0x6E, 0x00, 0x02, 0x05, 0x12, 0x80, 0x72, 0x6E, 0x00, 0x03, 0x08, 0x14, 0x1C, 0x82,
+    0x65, 0x69, 0x72, 0x00, 0x03, 0x14, 0x09, 0x06, 0x83, 0x6C, 0x74, 0x65, 0x72, 0x00, 0x04, 0x14,
+    0x13, 0x09, 0x0C, 0x82, 0x65, 0x6E, 0x65, 0x72, 0x00, 0x02, 0x09, 0x17, 0x81, 0x74, 0x68, 0x00,
+    0x03, 0x0E, 0x05, 0x0C, 0x81, 0x74, 0x68, 0x00, 0x05, 0x12, 0x01, 0x10, 0x10, 0x01, 0x82, 0x65,
+    0x6E, 0x74, 0x00, 0x02, 0x0F, 0x03, 0x82, 0x6E, 0x73, 0x74, 0x00, 0x03, 0x10, 0x15, 0x0F, 0x83,
+    0x74, 0x70, 0x75, 0x74, 0x00, 0x03, 0x06, 0x05, 0x12, 0x81, 0x72, 0x65, 0x64, 0x00, 0x03, 0x03,
+    0x03, 0x0F, 0x81, 0x72, 0x65, 0x64, 0x00, 0x04, 0x12, 0x01, 0x15, 0x07, 0x82, 0x6E, 0x74, 0x65,
+    0x65, 0x00, 0x05, 0x01, 0x12, 0x15, 0x01, 0x07, 0x87, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65,
+    0x65, 0x00, 0x01, 0x06, 0x83, 0x61, 0x6C, 0x73, 0x65, 0x00, 0x03, 0x03, 0x05, 0x02, 0x83, 0x61,
+    0x75, 0x73, 0x65, 0x00, 0x02, 0x04, 0x15, 0x84, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00, 0x04, 0x05,
+    0x10, 0x05, 0x13, 0x84, 0x61, 0x72, 0x61, 0x74, 0x65, 0x00, 0x04, 0x05, 0x0C, 0x05, 0x12, 0x82,
+    0x61, 0x6E, 0x74, 0x00, 0x02, 0x0E, 0x09, 0x83, 0x70, 0x75, 0x74, 0x00, 0x01, 0x0F, 0x82, 0x74,
+    0x70, 0x75, 0x74, 0x00, 0x02, 0x09, 0x0C, 0x83, 0x69, 0x73, 0x6F, 0x6E, 0x00, 0x04, 0x01, 0x03,
+    0x03, 0x0F, 0x83, 0x69, 0x6F, 0x6E, 0x00, 0x05, 0x14, 0x09, 0x10, 0x05, 0x12, 0x86, 0x65, 0x74,
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x02, 0x0F, 0x10, 0x83, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00,
+    0x02, 0x10, 0x01, 0x84, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x03, 0x0F, 0x03, 0x01, 0x87,
+    0x63, 0x6F, 0x6D, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x03, 0x03, 0x03, 0x01, 0x84, 0x6D,
+    0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x85, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x01,
+    0x01, 0x83, 0x65, 0x6E, 0x74, 0x00
+};
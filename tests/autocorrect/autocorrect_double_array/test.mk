@@ -0,0 +1,6 @@
+# Copyright 2023 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+AUTOCORRECT_ENABLE = yes
+
+SRC += ../test_autocorrect.cpp ../test_autocorrect_benchmark.cpp
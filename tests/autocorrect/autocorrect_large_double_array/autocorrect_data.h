@@ -0,0 +1,758 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Autocorrection dictionary (400 entries):
+//   :htere     -> there
+//   abbout     -> about
+//   abotu      -> about
+//   baout      -> about
+//   :theri     -> their
+//   :thier     -> their
+//   :owudl     -> would
+//   woudl      -> would
+//   peaple     -> people
+//   peolpe     -> people
+//   peopel     -> people
+//   poeple     -> people
+//   poeople    -> people
+//   :hwihc     -> which
+//   whcih      -> which
+//   whihc      -> which
+//   whlch      -> which
+//   wihch      -> which
+//   coudl      -> could
+//   :htikn     -> think
+//   :htink     -> think
+//   thikn      -> think
+//   thiunk     -> think
+//   tihkn      -> think
+//   :olther    -> other
+//   :otehr     -> other
+//   baceause   -> because
+//   beacuse    -> because
+//   becasue    -> because
+//   beccause   -> because
+//   becouse    -> because
+//   becuase    -> because
+//   theese     -> these
+//   :goign     -> going
+//   :gonig     -> going
+//   :yaers     -> years
+//   :yeasr     -> years
+//   :thsoe     -> those
+//   shoudl     -> should
+//   raelly     -> really
+//   realy      -> really
+//   relaly     -> really
+//   bedore     -> before
+//   befoer     -> before
+//   littel     -> little
+//   beeing     -> being
+//   :hwile     -> while
+//   aroud      -> around
+//   arround    -> around
+//   arund      -> around
+//   thign      -> thing
+//   thigsn     -> things
+//   thnigs     -> things
+//   anohter    -> another
+//   beteen     -> between
+//   beween     -> between
+//   bewteen    -> between
+//   :eveyr     -> every
+//   :graet     -> great
+//   :agian     -> again
+//   :sicne     -> since
+//   alwasy     -> always
+//   alwyas     -> always
+//   throught   -> thought
+//   :acheiv    -> achiev
+//   almsot     -> almost
+//   alomst     -> almost
+//   chnage     -> change
+//   chekc      -> check
+//   childen    -> children
+//   claer      -> clear
+//   comapny    -> company
+//   contian    -> contain
+//   elasped    -> elapsed
+//   feild      -> field
+//   fitler     -> filter
+//   firts      -> first
+//   follwo     -> follow
+//   :foudn     -> found
+//   frequecy   -> frequency
+//   firend     -> friend
+//   freind     -> friend
+//   heigth     -> height
+//   iamge      -> image
+//   inital     -> initial
+//   intput     -> input
+//   laguage    -> language
+//   lenght     -> length
+//   levle      -> level
+//   libary     -> library
+//   :moeny     -> money
+//   mysefl     -> myself
+//   ouptut     -> output
+//   ouput      -> output
+//   probaly    -> probably
+//   probelm    -> problem
+//   recrod     -> record
+//   reponse    -> response
+//   reprot     -> report
+//   singel     -> single
+//   stregth    -> strength
+//   strengh    -> strength
+//   tkaes      -> takes
+//   therfore   -> therefore
+//   todya      -> today
+//   toghether  -> together
+//   unkown     -> unknown
+//   unqiue     -> unique
+//   widht      -> width
+//   aberation  -> aberration
+//   accross    -> across
+//   adviced    -> advised
+//   aledge     -> allege
+//   alledge    -> allege
+//   amature    -> amateur
+//   anomolous  -> anomalous
+//   anomoly    -> anomaly
+//   aparent    -> apparent
+//   aparrent   -> apparent
+//   apparant   -> apparent
+//   apparrent  -> apparent
+//   asthetic   -> aesthetic
+//   auxilary   -> auxiliary
+//   auxillary  -> auxiliary
+//   auxilliary -> auxiliary
+//   bankrupcy  -> bankruptcy
+//   busness    -> business
+//   bussiness  -> business
+//   calander   -> calendar
+//   commitee   -> committee
+//   comittee   -> committee
+//   competance -> competence
+//   competant  -> competent
+//   concensus  -> consensus
+//   cognizent  -> cognizant
+//   copywrite: -> copyright
+//   choosen    -> chosen
+//   collegue   -> colleague
+//   excercise  -> exercise
+//   :grammer   -> grammar
+//   :guage     -> gauge
+//   govement   -> government
+//   govenment  -> government
+//   goverment  -> government
+//   governmnet -> government
+//   govorment  -> government
+//   govornment -> government
+//   guaratee   -> guarantee
+//   garantee   -> guarantee
+//   gaurantee  -> guarantee
+//   heirarchy  -> hierarchy
+//   hygeine    -> hygiene
+//   hypocracy  -> hypocrisy
+//   hypocrasy  -> hypocrisy
+//   hypocricy  -> hypocrisy
+//   hypocrit:  -> hypocrite
+//   looses:    -> loses
+//   maintence  -> maintenance
+//   morgage    -> mortgage
+//   neccesary  -> necessary
+//   necesary   -> necessary
+//   pallete    -> palette
+//   paralel    -> parallel
+//   parralel   -> parallel
+//   parrallel  -> parallel
+//   priviledge -> privilege
+//   probablly  -> probably
+//   prominant  -> prominent
+//   propogate  -> propagate
+//   proove     -> prove
+//   psuedo     -> pseudo
+//   reciept    -> receipt
+//   receiev    -> receiv
+//   reciev     -> receiv
+//   recepient  -> recipient
+//   recipiant  -> recipient
+//   relevent   -> relevant
+//   repitition -> repetition
+//   safty      -> safety
+//   saftey     -> safety
+//   seperat    -> separat
+//   spectogram -> spectrogram
+//   symetric   -> symmetric
+//   tolerence  -> tolerance
+//   cacheing   -> caching
+//   complier   -> compiler
+//   doulbe     -> double
+//   dyanmic    -> dynamic
+//   excecut    -> execut
+//   failse     -> false
+//   fales      -> false
+//   fasle      -> false
+//   flase      -> false
+//   indeces    -> indices
+//   indecies   -> indices
+//   indicies   -> indices
+//   interator  -> iterator
+//   looup      -> lookup
+//   namesapce  -> namespace
+//   namespcae  -> namespace
+//   nulltpr    -> nullptr
+//   operaotr   -> operator
+//   overide    -> override
+//   ovveride   -> override
+//   poitner    -> pointer
+//   :rference  -> reference
+//   referece   -> reference
+//   singed     -> signed
+//   stirng     -> string
+//   strign     -> string
+//   swithc     -> switch
+//   swtich     -> switch
+//   teamplate  -> template
+//   tempalte   -> template
+//   :ture      -> true
+//   retrun     -> return
+//   retun      -> return
+//   reutrn     -> return
+//   cosnt      -> const
+//   virutal    -> virtual
+//   vitual     -> virtual
+//   yeild      -> yield
+//   :alot:     -> a lot
+//   :andteh    -> and the
+//   :andthe    -> and the
+//   :asthe     -> as the
+//   :atthe     -> at the
+//   abouta     -> about a
+//   aboutit    -> about it
+//   aboutthe   -> about the
+//   :tothe     -> to the
+//   didnot     -> did not
+//   fromthe    -> from the
+//   :agred     -> agreed
+//   :ajust     -> adjust
+//   :anual     -> annual
+//   :asign     -> assign
+//   :aslo:     -> also
+//   :casue     -> cause
+//   :choses    -> chooses
+//   :gaurd     -> guard
+//   :haev      -> have
+//   :hapen     -> happen
+//   :idaes     -> ideas
+//   :jsut:     -> just
+//   :jstu:     -> just
+//   :knwo      -> know
+//   :konw      -> know
+//   :kwno      -> know
+//   :ocuntry   -> country
+//   :ocur      -> occur
+//   :socre     -> score
+//   :szie      -> size
+//   :the:the:  -> the
+//   :turth     -> truth
+//   :uesd:     -> used
+//   :usally    -> usually
+//   abilties   -> abilities
+//   abilty     -> ability
+//   abvove     -> above
+//   accesories -> accessories
+//   accomodate -> accommodate
+//   acommodate -> accommodate
+//   acomplish  -> accomplish
+//   actualy    -> actually
+//   acurate    -> accurate
+//   acutally   -> actually
+//   addtion    -> addition
+//   againnst   -> against
+//   aganist    -> against
+//   aggreed    -> agreed
+//   agianst    -> against
+//   ahppn      -> happen
+//   allign     -> align
+//   anytying   -> anything
+//   aquire     -> acquire
+//   availabe   -> available
+//   availaible -> available
+//   availalbe  -> available
+//   availble   -> available
+//   availiable -> available
+//   avalable   -> available
+//   avaliable  -> available
+//   avilable   -> available
+//   bandwith   -> bandwidth
+//   begginer   -> beginner
+//   beleif     -> belief
+//   beleive    -> believe
+//   belive     -> believe
+//   breif      -> brief
+//   burried    -> buried
+//   caluclate  -> calculate
+//   caluculate -> calculate
+//   calulate   -> calculate
+//   catagory   -> category
+//   cauhgt     -> caught
+//   ceratin    -> certain
+//   certian    -> certain
+//   cheif      -> chief
+//   cieling    -> ceiling
+//   circut     -> circuit
+//   clasic     -> classic
+//   cmoputer   -> computer
+//   coform     -> conform
+//   comming:   -> coming
+//   considerd  -> considered
+//   dervied    -> derived
+//   desicion   -> decision
+//   diferent   -> different
+//   diferrent  -> different
+//   differnt   -> different
+//   diffrent   -> different
+//   divison    -> division
+//   effecient  -> efficient
+//   eligable   -> eligible
+//   elpased    -> elapsed
+//   embarass   -> embarrass
+//   embeded    -> embedded
+//   encypt     -> encrypt
+//   finaly     -> finally
+//   foriegn    -> foreign
+//   foward     -> forward
+//   fraciton   -> fraction
+//   fucntion   -> function
+//   fufill     -> fulfill
+//   fullfill   -> fulfill
+//   futher     -> further
+//   ganerate   -> generate
+//   generaly   -> generally
+//   greatful   -> grateful
+//   heigher    -> higher
+//   higest     -> highest
+//   howver     -> however
+//   hydogen    -> hydrogen
+//   importamt  -> important
+//   inclued    -> include
+//   insted     -> instead
+//   intrest    -> interest
+//   invliad    -> invalid
+//   largst     -> largest
+//   learnign   -> learning
+//   liasion    -> liaison
+//   likly      -> likely
+//   lisense    -> license
+//   listner    -> listener
+//   macthing   -> matching
+//   manefist   -> manifest
+//   mesage     -> message
+//   naturual   -> natural
+//   occassion  -> occasion
+//   occured    -> occurred
+//   particualr -> particular
+//   paticular  -> particular
+//   peice      -> piece
+//   perhasp    -> perhaps
+//   perheaps   -> perhaps
+//   perhpas    -> perhaps
+//   perphas    -> perhaps
+//   persue     -> pursue
+//   posess     -> possess
+//   postion    -> position
+//   preiod     -> period
+//   primarly   -> primarily
+//   privte     -> private
+//   proccess   -> process
+//   proeprty   -> property
+//   propery    -> property
+//   realtion   -> relation
+//   reasearch  -> research
+//   recuring   -> recurring
+//   refered    -> referred
+//   regluar    -> regular
+//   releated   -> related
+//   resutl     -> result
+//   reuslt     -> result
+//   reveiw     -> review
+//   satisifed  -> satisfied
+//   scheduel   -> schedule
+//   sequnce    -> sequence
+//   similiar   -> similar
+//   simmilar   -> similar
+//   slighly    -> slightly
+//   somehwat   -> somewhat
+//   statment   -> statement
+//   sucess     -> success
+//   succsess   -> success
+//   sugest     -> suggest
+//   sumary     -> summary
+//   supress    -> suppress
+//   surpress   -> suppress
+//   thresold   -> threshold
+//   tongiht    -> tonight
+//   tranpose   -> transpose
+//   typcial    -> typical
+//   udpate     -> update
+//   ususally   -> usually
+//   verticies  -> vertices
+//   whereever  -> wherever
+//   wherre     -> where
+//   wierd      -> weird
+
+#define AUTOCORRECT_MIN_LENGTH 5 // "abotu"
+#define AUTOCORRECT_MAX_LENGTH 10 // "auxilliary"
+#define AUTOCORRECT_DOUBLE_ARRAY_SIZE 615
+#define AUTOCORRECT_CORRECTIONS_SIZE 4016
+#define AUTOCORRECT_LEAF 0x8000
+
+static const uint16_t autocorrect_base[AUTOCORRECT_DOUBLE_ARRAY_SIZE] PROGMEM = {
+    0, 4, 0, 22, 31, 52, 1, 25, 72, 32768, 57, 3, 81, 26, 99, 74, 16, 90, 111, 128, 149, 32778, 42,
+    49, 32787, 164, 169, 32966, 170, 32796, 56, 76, 32812, 32804, 32874, 33091, 189, 33101, 32983,
+    142, 349, 33576, 161, 33, 32994, 100, 32, 253, 33543, 138, 33587, 33287, 32824, 32832, 68, 197,
+    17, 20, 33298, 124, 63, 32845, 382, 33308, 210, 323, 104, 32854, 32864, 33617, 212, 230, 133,
+    209, 75, 228, 33398, 32884, 33071, 32896, 344, 32906, 132, 357, 375, 77, 236, 32933, 33082,
+    33406, 374, 32915, 179, 115, 33418, 33432, 33441, 208, 398, 33927, 131, 32942, 32951, 33006,
+    254, 33555, 194, 33695, 33015, 33566, 171, 33938, 229, 33704, 205, 33027, 263, 33039, 33050,
+    33110, 153, 329, 33060, 33120, 260, 352, 33134, 33151, 218, 266, 33162, 33171, 33183, 278, 379,
+    33201, 33192, 33660, 33800, 33596, 297, 33946, 300, 289, 33212, 33811, 33224, 248, 33235, 185,
+    237, 393, 383, 389, 233, 33823, 33243, 285, 33253, 33607, 33854, 33264, 33275, 283, 281, 176,
+    479, 305, 298, 33317, 293, 34074, 33327, 34083, 33345, 316, 314, 33355, 264, 34043, 409, 34396,
+    315, 141, 321, 33367, 397, 405, 33906, 33377, 319, 33388, 33457, 33467, 33477, 33488, 33501,
+    33917, 320, 34032, 34257, 34407, 33627, 408, 34271, 33511, 33638, 336, 33522, 267, 33534, 347,
+    355, 33647, 411, 33715, 33832, 33725, 33844, 33669, 34090, 33736, 34098, 348, 34052, 34062, 373,
+    345, 381, 33680, 33748, 341, 33688, 245, 34309, 33755, 33864, 33873, 34105, 33763, 33883, 415,
+    33778, 33957, 370, 33787, 33891, 34318, 407, 34234, 34115, 378, 33965, 437, 34457, 34286, 33973,
+    33981, 33991, 392, 34297, 34001, 438, 34246, 34126, 483, 500, 34134, 34749, 34549, 34013, 418,
+    420, 34022, 34175, 34147, 34157, 424, 34167, 431, 34558, 34205, 34186, 426, 439, 332, 34760,
+    434, 449, 34331, 34216, 34196, 425, 34785, 34338, 34368, 459, 34223, 34795, 34378, 34387, 34349,
+    34360, 442, 35293, 34417, 34464, 455, 464, 452, 34476, 34426, 462, 34447, 34487, 476, 480, 501,
+    35841, 34436, 34569, 34498, 34510, 35852, 34636, 34520, 478, 34606, 34660, 34528, 34578, 34689,
+    34538, 34614, 34670, 34591, 34645, 35479, 34705, 34623, 34680, 34724, 34714, 34733, 34767,
+    34803, 34695, 34777, 34822, 34999, 34845, 35008, 450, 35020, 525, 35490, 489, 34740, 34856,
+    34879, 559, 34908, 35028, 353, 34946, 34814, 34890, 34958, 34835, 34866, 34918, 34899, 34928,
+    377, 34969, 35038, 34937, 485, 34978, 497, 35105, 35061, 447, 430, 558, 35049, 35072, 35115,
+    34988, 35123, 35138, 492, 35224, 35028, 35145, 35085, 35130, 482, 502, 35095, 35153, 35160,
+    35207, 35242, 35232, 35173, 35217, 35251, 456, 35260, 531, 35185, 511, 506, 35373, 35301, 35311,
+    35357, 35196, 35280, 35317, 35270, 35325, 35334, 35386, 35413, 35341, 35348, 35424, 35363, 504,
+    516, 35432, 35443, 35455, 35499, 35397, 528, 519, 35542, 515, 35728, 35507, 35736, 513, 552,
+    35549, 35465, 35561, 535, 561, 529, 35515, 35572, 35530, 475, 524, 35583, 538, 35593, 35625,
+    35636, 537, 35658, 35678, 35695, 35704, 544, 547, 35648, 35866, 35604, 35712, 35720, 569, 35614,
+    35669, 35688, 35743, 527, 35791, 35752, 35810, 35800, 35905, 35859, 35877, 35967, 35758, 35819,
+    35767, 556, 549, 35832, 35774, 35941, 35895, 35783, 551, 521, 35919, 563, 35929, 35980, 35859,
+    36071, 35885, 35991, 35954, 36007, 35998, 35913, 36018, 564, 36012, 36037, 36053, 36090, 36220,
+    36045, 36103, 36028, 36192, 36080, 36162, 36113, 576, 36259, 36128, 36007, 36140, 36174, 36201,
+    36210, 36061, 36152, 36229, 565, 36237, 36268, 36183, 36276, 36302, 590, 36359, 36325, 560,
+    36375, 36249, 36336, 36348, 570, 578, 579, 36289, 568, 36367, 36314, 36387, 36408, 36425, 36397,
+    577, 591, 36447, 580, 36494, 36470, 36432, 36524, 36507, 36441, 36458, 36585, 36539, 36559,
+    36483, 36550, 581, 593, 0, 584, 36609, 36596, 36621, 36531, 36418, 36514, 36571, 36501, 36634,
+    36660, 36685, 36706, 36643, 36721, 36749, 598, 36760, 36768, 36696, 36650, 0, 36733, 0, 0, 0, 0,
+    0, 0, 0, 36672, 36741, 0, 36777
+};
+
+static const uint8_t autocorrect_check[AUTOCORRECT_DOUBLE_ARRAY_SIZE] PROGMEM = {
+    0, 1, 0, 3, 4, 5, 6, 7, 8, 9, 9, 11, 12, 13, 14, 15, 16, 14, 18, 19, 20, 21, 22, 23, 20, 25, 9,
+    1, 28, 25, 8, 9, 1, 11, 9, 19, 5, 21, 12, 14, 20, 9, 9, 12, 18, 14, 15, 5, 15, 18, 18, 9, 21, 1,
+    2, 3, 4, 5, 9, 7, 8, 9, 5, 14, 12, 9, 14, 15, 16, 1, 18, 19, 20, 21, 22, 3, 20, 5, 4, 7, 12, 9,
+    1, 20, 9, 4, 5, 6, 14, 13, 15, 19, 20, 12, 18, 19, 20, 23, 21, 9, 1, 20, 21, 4, 5, 5, 7, 3, 9,
+    9, 11, 21, 1, 9, 15, 16, 5, 18, 19, 8, 21, 21, 23, 12, 9, 1, 15, 16, 4, 1, 19, 20, 21, 5, 1, 7,
+    25, 13, 5, 1, 9, 9, 1, 5, 16, 12, 18, 19, 20, 21, 1, 9, 20, 21, 5, 22, 7, 8, 9, 21, 18, 12, 13,
+    14, 15, 16, 5, 3, 19, 5, 21, 18, 8, 20, 4, 5, 12, 7, 14, 8, 9, 5, 18, 19, 20, 15, 7, 18, 9, 19,
+    20, 21, 3, 4, 5, 6, 7, 18, 9, 5, 15, 25, 5, 9, 19, 16, 9, 18, 19, 20, 21, 14, 2, 16, 9, 3, 7, 5,
+    9, 9, 12, 9, 14, 5, 19, 20, 16, 15, 19, 19, 18, 1, 22, 21, 1, 5, 8, 9, 9, 9, 12, 12, 12, 7, 14,
+    15, 18, 14, 12, 1, 21, 21, 16, 5, 1, 18, 20, 21, 4, 5, 23, 7, 9, 15, 1, 20, 6, 4, 1, 5, 16, 8,
+    9, 19, 8, 12, 13, 14, 15, 1, 16, 3, 16, 20, 1, 22, 19, 9, 5, 4, 12, 25, 7, 4, 9, 14, 3, 19, 9,
+    18, 19, 18, 19, 5, 7, 7, 1, 9, 15, 16, 5, 13, 14, 20, 9, 1, 1, 20, 18, 21, 5, 16, 8, 23, 8, 11,
+    12, 6, 9, 15, 15, 8, 18, 12, 15, 20, 20, 5, 18, 18, 21, 5, 22, 7, 15, 1, 23, 18, 1, 4, 1, 6, 5,
+    12, 1, 23, 1, 21, 9, 7, 12, 4, 21, 14, 9, 21, 14, 12, 21, 20, 13, 19, 15, 21, 1, 5, 19, 20, 5,
+    1, 5, 3, 1, 4, 7, 15, 7, 12, 15, 15, 8, 12, 9, 15, 12, 16, 22, 18, 5, 18, 18, 8, 5, 14, 21, 12,
+    9, 18, 1, 20, 5, 18, 20, 15, 3, 23, 8, 8, 25, 12, 12, 23, 14, 15, 9, 7, 18, 19, 8, 20, 19, 20,
+    12, 9, 8, 4, 21, 3, 20, 14, 3, 3, 11, 5, 20, 15, 21, 21, 9, 7, 3, 14, 18, 14, 20, 18, 19, 18, 9,
+    20, 18, 6, 13, 1, 5, 1, 2, 18, 18, 14, 20, 22, 20, 21, 18, 26, 14, 18, 2, 1, 2, 5, 2, 5, 1, 6,
+    1, 5, 12, 9, 14, 16, 12, 13, 18, 3, 7, 21, 9, 19, 3, 12, 5, 21, 25, 1, 21, 5, 16, 3, 8, 28, 12,
+    21, 8, 14, 5, 1, 3, 18, 4, 21, 9, 19, 5, 9, 5, 3, 12, 23, 14, 12, 19, 5, 23, 19, 21, 9, 9, 15,
+    21, 3, 5, 18, 9, 1, 19, 20, 19, 5, 6, 14, 5, 22, 16, 18, 21, 20, 9, 1, 1, 12, 18, 12, 1, 13, 5,
+    3, 9, 4, 1, 12, 9, 5, 18, 5, 12, 21, 1, 3, 0, 21, 5, 15, 6, 20, 28, 18, 18, 28, 12, 1, 1, 13,
+    15, 15, 3, 16, 5, 1, 9, 22, 0, 19, 0, 0, 0, 0, 0, 0, 0, 21, 28, 0, 16
+};
+
+static const uint8_t autocorrect_corrections[AUTOCORRECT_CORRECTIONS_SIZE] PROGMEM = {
+    0x05, 0x12, 0x05, 0x08, 0x14, 0x1C, 0x81, 0x69, 0x72, 0x00, 0x04, 0x14, 0x0F, 0x02, 0x01, 0x81,
+    0x75, 0x74, 0x00, 0x04, 0x15, 0x0F, 0x02, 0x01, 0x80, 0x20, 0x61, 0x00, 0x03, 0x04, 0x0F, 0x14,
+    0x81, 0x61, 0x79, 0x00, 0x03, 0x05, 0x08, 0x03, 0x81, 0x63, 0x6B, 0x00, 0x05, 0x09, 0x0C, 0x16,
+    0x0E, 0x09, 0x83, 0x61, 0x6C, 0x69, 0x64, 0x00, 0x03, 0x0F, 0x12, 0x01, 0x80, 0x6E, 0x64, 0x00,
+    0x07, 0x03, 0x10, 0x13, 0x05, 0x0D, 0x01, 0x0E, 0x82, 0x61, 0x63, 0x65, 0x00, 0x03, 0x1A, 0x13,
+    0x1C, 0x82, 0x69, 0x7A, 0x65, 0x00, 0x04, 0x13, 0x08, 0x14, 0x1C, 0x82, 0x6F, 0x73, 0x65, 0x00,
+    0x04, 0x0C, 0x0F, 0x05, 0x10, 0x82, 0x70, 0x6C, 0x65, 0x00, 0x04, 0x0E, 0x0F, 0x07, 0x1C, 0x82,
+    0x69, 0x6E, 0x67, 0x00, 0x05, 0x14, 0x04, 0x0E, 0x01, 0x1C, 0x82, 0x20, 0x74, 0x68, 0x65, 0x00,
+    0x05, 0x0E, 0x05, 0x12, 0x14, 0x13, 0x80, 0x74, 0x68, 0x00, 0x03, 0x03, 0x08, 0x17, 0x82, 0x69,
+    0x63, 0x68, 0x00, 0x07, 0x09, 0x0C, 0x10, 0x0D, 0x0F, 0x03, 0x01, 0x86, 0x63, 0x6F, 0x6D, 0x70,
+    0x6C, 0x69, 0x73, 0x68, 0x00, 0x04, 0x05, 0x13, 0x19, 0x0D, 0x81, 0x6C, 0x66, 0x00, 0x04, 0x15,
+    0x13, 0x05, 0x12, 0x81, 0x6C, 0x74, 0x00, 0x06, 0x06, 0x14, 0x01, 0x05, 0x12, 0x07, 0x85, 0x61,
+    0x74, 0x65, 0x66, 0x75, 0x6C, 0x00, 0x08, 0x12, 0x07, 0x0F, 0x14, 0x03, 0x05, 0x10, 0x13, 0x84,
+    0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x00, 0x05, 0x05, 0x02, 0x0F, 0x12, 0x10, 0x82, 0x6C, 0x65,
+    0x6D, 0x00, 0x04, 0x0F, 0x06, 0x0F, 0x03, 0x83, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x00, 0x04, 0x15,
+    0x0F, 0x06, 0x1C, 0x81, 0x6E, 0x64, 0x00, 0x05, 0x14, 0x01, 0x12, 0x05, 0x03, 0x83, 0x74, 0x61,
+    0x69, 0x6E, 0x00, 0x03, 0x10, 0x08, 0x01, 0x84, 0x68, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x00, 0x04,
+    0x14, 0x15, 0x05, 0x12, 0x83, 0x74, 0x75, 0x72, 0x6E, 0x00, 0x04, 0x07, 0x09, 0x08, 0x14, 0x82,
+    0x6E, 0x67, 0x73, 0x00, 0x04, 0x0F, 0x0B, 0x0E, 0x15, 0x82, 0x6E, 0x6F, 0x77, 0x6E, 0x00, 0x04,
+    0x05, 0x15, 0x13, 0x10, 0x83, 0x65, 0x75, 0x64, 0x6F, 0x00, 0x03, 0x17, 0x0B, 0x1C, 0x82, 0x6E,
+    0x6F, 0x77, 0x00, 0x05, 0x01, 0x08, 0x12, 0x05, 0x10, 0x81, 0x70, 0x73, 0x00, 0x03, 0x0F, 0x0F,
+    0x0C, 0x81, 0x6B, 0x75, 0x70, 0x00, 0x04, 0x05, 0x14, 0x0F, 0x1C, 0x82, 0x68, 0x65, 0x72, 0x00,
+    0x08, 0x01, 0x15, 0x03, 0x09, 0x14, 0x12, 0x01, 0x10, 0x82, 0x6C, 0x61, 0x72, 0x00, 0x07, 0x14,
+    0x01, 0x12, 0x05, 0x14, 0x0E, 0x09, 0x87, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x05,
+    0x14, 0x0C, 0x0C, 0x15, 0x0E, 0x82, 0x70, 0x74, 0x72, 0x00, 0x04, 0x01, 0x05, 0x19, 0x1C, 0x81,
+    0x72, 0x73, 0x00, 0x06, 0x0F, 0x01, 0x12, 0x05, 0x10, 0x0F, 0x82, 0x74, 0x6F, 0x72, 0x00, 0x03,
+    0x03, 0x0F, 0x1C, 0x81, 0x63, 0x75, 0x72, 0x00, 0x04, 0x05, 0x16, 0x05, 0x1C, 0x81, 0x72, 0x79,
+    0x00, 0x04, 0x09, 0x0E, 0x08, 0x14, 0x83, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x06, 0x01, 0x05, 0x08,
+    0x12, 0x05, 0x10, 0x83, 0x61, 0x70, 0x73, 0x00, 0x04, 0x05, 0x01, 0x19, 0x1C, 0x83, 0x65, 0x61,
+    0x72, 0x73, 0x00, 0x03, 0x12, 0x09, 0x06, 0x81, 0x73, 0x74, 0x00, 0x04, 0x08, 0x15, 0x01, 0x03,
+    0x82, 0x67, 0x68, 0x74, 0x00, 0x05, 0x14, 0x15, 0x0F, 0x02, 0x01, 0x81, 0x20, 0x69, 0x74, 0x00,
+    0x04, 0x13, 0x15, 0x05, 0x12, 0x83, 0x73, 0x75, 0x6C, 0x74, 0x00, 0x07, 0x01, 0x14, 0x12, 0x0F,
+    0x10, 0x0D, 0x09, 0x81, 0x6E, 0x74, 0x00, 0x05, 0x05, 0x08, 0x03, 0x01, 0x1C, 0x82, 0x69, 0x65,
+    0x76, 0x00, 0x04, 0x05, 0x16, 0x05, 0x12, 0x82, 0x69, 0x65, 0x77, 0x00, 0x03, 0x0F, 0x0B, 0x1C,
+    0x82, 0x6E, 0x6F, 0x77, 0x00, 0x04, 0x14, 0x06, 0x01, 0x13, 0x82, 0x65, 0x74, 0x79, 0x00, 0x07,
+    0x03, 0x12, 0x01, 0x12, 0x09, 0x05, 0x08, 0x87, 0x69, 0x65, 0x72, 0x61, 0x72, 0x63, 0x68, 0x79,
+    0x00, 0x04, 0x13, 0x05, 0x15, 0x1C, 0x83, 0x73, 0x65, 0x64, 0x00, 0x06, 0x0E, 0x09, 0x0D, 0x0D,
+    0x0F, 0x03, 0x84, 0x69, 0x6E, 0x67, 0x00, 0x04, 0x0C, 0x13, 0x01, 0x1C, 0x83, 0x6C, 0x73, 0x6F,
+    0x00, 0x05, 0x05, 0x13, 0x0F, 0x0F, 0x0C, 0x84, 0x73, 0x65, 0x73, 0x00, 0x04, 0x14, 0x13, 0x0A,
+    0x1C, 0x83, 0x75, 0x73, 0x74, 0x00, 0x03, 0x09, 0x17, 0x13, 0x81, 0x63, 0x68, 0x00, 0x04, 0x0E,
+    0x01, 0x19, 0x04, 0x84, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x00, 0x05, 0x14, 0x05, 0x0D, 0x19, 0x13,
+    0x84, 0x6D, 0x65, 0x74, 0x72, 0x69, 0x63, 0x00, 0x03, 0x01, 0x0C, 0x03, 0x81, 0x73, 0x69, 0x63,
+    0x00, 0x05, 0x05, 0x08, 0x14, 0x13, 0x01, 0x86, 0x65, 0x73, 0x74, 0x68, 0x65, 0x74, 0x69, 0x63,
+    0x00, 0x04, 0x09, 0x16, 0x04, 0x01, 0x82, 0x73, 0x65, 0x64, 0x00, 0x04, 0x05, 0x02, 0x0D, 0x05,
+    0x81, 0x64, 0x65, 0x64, 0x00, 0x04, 0x12, 0x07, 0x07, 0x01, 0x84, 0x72, 0x65, 0x65, 0x64, 0x00,
+    0x06, 0x09, 0x13, 0x09, 0x14, 0x01, 0x13, 0x83, 0x66, 0x69, 0x65, 0x64, 0x00, 0x03, 0x0E, 0x09,
+    0x13, 0x83, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x04, 0x13, 0x01, 0x0C, 0x05, 0x83, 0x70, 0x73, 0x65,
+    0x64, 0x00, 0x04, 0x01, 0x10, 0x0C, 0x05, 0x84, 0x61, 0x70, 0x73, 0x65, 0x64, 0x00, 0x04, 0x0C,
+    0x03, 0x0E, 0x09, 0x81, 0x64, 0x65, 0x00, 0x05, 0x13, 0x05, 0x12, 0x08, 0x14, 0x82, 0x68, 0x6F,
+    0x6C, 0x64, 0x00, 0x03, 0x12, 0x09, 0x06, 0x84, 0x72, 0x69, 0x65, 0x6E, 0x64, 0x00, 0x03, 0x05,
+    0x12, 0x06, 0x83, 0x69, 0x65, 0x6E, 0x64, 0x00, 0x03, 0x05, 0x12, 0x10, 0x84, 0x65, 0x72, 0x69,
+    0x6F, 0x64, 0x00, 0x03, 0x03, 0x05, 0x12, 0x82, 0x6F, 0x72, 0x64, 0x00, 0x03, 0x17, 0x0F, 0x06,
+    0x83, 0x72, 0x77, 0x61, 0x72, 0x64, 0x00, 0x03, 0x01, 0x07, 0x1C, 0x83, 0x75, 0x61, 0x72, 0x64,
+    0x00, 0x05, 0x0C, 0x09, 0x01, 0x16, 0x01, 0x80, 0x6C, 0x65, 0x00, 0x05, 0x12, 0x05, 0x06, 0x05,
+    0x12, 0x81, 0x6E, 0x63, 0x65, 0x00, 0x02, 0x05, 0x10, 0x83, 0x69, 0x65, 0x63, 0x65, 0x00, 0x06,
+    0x01, 0x13, 0x05, 0x0D, 0x01, 0x0E, 0x83, 0x70, 0x61, 0x63, 0x65, 0x00, 0x02, 0x01, 0x09, 0x83,
+    0x6D, 0x61, 0x67, 0x65, 0x00, 0x03, 0x17, 0x08, 0x1C, 0x84, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00,
+    0x02, 0x01, 0x06, 0x82, 0x6C, 0x73, 0x65, 0x00, 0x02, 0x05, 0x0C, 0x81, 0x65, 0x6C, 0x00, 0x03,
+    0x09, 0x13, 0x1C, 0x82, 0x6E, 0x63, 0x65, 0x00, 0x04, 0x05, 0x07, 0x19, 0x08, 0x83, 0x69, 0x65,
+    0x6E, 0x65, 0x00, 0x03, 0x0F, 0x13, 0x1C, 0x83, 0x63, 0x6F, 0x72, 0x65, 0x00, 0x03, 0x14, 0x08,
+    0x1C, 0x84, 0x74, 0x68, 0x65, 0x72, 0x65, 0x00, 0x03, 0x15, 0x11, 0x01, 0x84, 0x63, 0x71, 0x75,
+    0x69, 0x72, 0x65, 0x00, 0x03, 0x05, 0x08, 0x17, 0x81, 0x65, 0x00, 0x03, 0x05, 0x08, 0x14, 0x82,
+    0x73, 0x65, 0x00, 0x06, 0x03, 0x12, 0x05, 0x03, 0x18, 0x05, 0x86, 0x65, 0x72, 0x63, 0x69, 0x73,
+    0x65, 0x00, 0x03, 0x09, 0x01, 0x06, 0x83, 0x6C, 0x73, 0x65, 0x00, 0x05, 0x10, 0x0E, 0x01, 0x12,
+    0x14, 0x83, 0x73, 0x70, 0x6F, 0x73, 0x65, 0x00, 0x04, 0x0C, 0x0C, 0x01, 0x10, 0x83, 0x65, 0x74,
+    0x74, 0x65, 0x00, 0x05, 0x01, 0x10, 0x0D, 0x05, 0x14, 0x83, 0x6C, 0x61, 0x74, 0x65, 0x00, 0x03,
+    0x09, 0x12, 0x10, 0x81, 0x61, 0x74, 0x65, 0x00, 0x05, 0x05, 0x0C, 0x0C, 0x0F, 0x03, 0x82, 0x61,
+    0x67, 0x75, 0x65, 0x00, 0x03, 0x11, 0x0E, 0x15, 0x83, 0x69, 0x71, 0x75, 0x65, 0x00, 0x03, 0x09,
+    0x14, 0x13, 0x83, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x02, 0x09, 0x17, 0x83, 0x68, 0x69, 0x63, 0x68,
+    0x00, 0x03, 0x14, 0x17, 0x13, 0x83, 0x69, 0x74, 0x63, 0x68, 0x00, 0x02, 0x08, 0x17, 0x82, 0x69,
+    0x63, 0x68, 0x00, 0x06, 0x01, 0x05, 0x13, 0x01, 0x05, 0x12, 0x86, 0x73, 0x65, 0x61, 0x72, 0x63,
+    0x68, 0x00, 0x05, 0x17, 0x04, 0x0E, 0x01, 0x02, 0x81, 0x64, 0x74, 0x68, 0x00, 0x03, 0x15, 0x14,
+    0x1C, 0x83, 0x72, 0x75, 0x74, 0x68, 0x00, 0x03, 0x14, 0x08, 0x1C, 0x84, 0x74, 0x68, 0x69, 0x6E,
+    0x6B, 0x00, 0x03, 0x09, 0x08, 0x14, 0x82, 0x6E, 0x6B, 0x00, 0x04, 0x03, 0x10, 0x19, 0x14, 0x83,
+    0x69, 0x63, 0x61, 0x6C, 0x00, 0x03, 0x0E, 0x09, 0x13, 0x81, 0x6C, 0x65, 0x00, 0x03, 0x0F, 0x05,
+    0x10, 0x81, 0x6C, 0x65, 0x00, 0x03, 0x14, 0x09, 0x0C, 0x81, 0x6C, 0x65, 0x00, 0x05, 0x04, 0x05,
+    0x08, 0x03, 0x13, 0x81, 0x6C, 0x65, 0x00, 0x04, 0x0C, 0x09, 0x08, 0x03, 0x81, 0x72, 0x65, 0x6E,
+    0x00, 0x04, 0x0F, 0x04, 0x19, 0x08, 0x83, 0x72, 0x6F, 0x67, 0x65, 0x6E, 0x00, 0x03, 0x01, 0x08,
+    0x1C, 0x81, 0x70, 0x65, 0x6E, 0x00, 0x04, 0x0F, 0x0F, 0x08, 0x03, 0x83, 0x73, 0x65, 0x6E, 0x00,
+    0x04, 0x09, 0x12, 0x0F, 0x06, 0x83, 0x65, 0x69, 0x67, 0x6E, 0x00, 0x02, 0x09, 0x14, 0x83, 0x68,
+    0x69, 0x6E, 0x6B, 0x00, 0x04, 0x09, 0x16, 0x09, 0x04, 0x81, 0x69, 0x6F, 0x6E, 0x00, 0x05, 0x09,
+    0x03, 0x01, 0x12, 0x06, 0x83, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x03, 0x14, 0x05, 0x12, 0x82, 0x75,
+    0x72, 0x6E, 0x00, 0x02, 0x05, 0x12, 0x80, 0x72, 0x6E, 0x00, 0x03, 0x0C, 0x0F, 0x06, 0x81, 0x6F,
+    0x77, 0x00, 0x02, 0x0B, 0x1C, 0x81, 0x6F, 0x77, 0x00, 0x05, 0x0C, 0x09, 0x0D, 0x09, 0x13, 0x82,
+    0x61, 0x72, 0x00, 0x04, 0x0C, 0x07, 0x05, 0x12, 0x83, 0x75, 0x6C, 0x61, 0x72, 0x00, 0x02, 0x0C,
+    0x03, 0x82, 0x65, 0x61, 0x72, 0x00, 0x05, 0x0E, 0x01, 0x0C, 0x01, 0x03, 0x84, 0x65, 0x6E, 0x64,
+    0x61, 0x72, 0x00, 0x03, 0x14, 0x09, 0x06, 0x83, 0x6C, 0x74, 0x65, 0x72, 0x00, 0x05, 0x0D, 0x01,
+    0x12, 0x07, 0x1C, 0x81, 0x61, 0x72, 0x00, 0x03, 0x06, 0x05, 0x02, 0x81, 0x72, 0x65, 0x00, 0x04,
+    0x10, 0x12, 0x05, 0x10, 0x83, 0x68, 0x61, 0x70, 0x73, 0x00, 0x04, 0x08, 0x12, 0x05, 0x10, 0x82,
+    0x61, 0x70, 0x73, 0x00, 0x03, 0x17, 0x0C, 0x01, 0x82, 0x61, 0x79, 0x73, 0x00, 0x04, 0x05, 0x04,
+    0x0E, 0x09, 0x83, 0x69, 0x63, 0x65, 0x73, 0x00, 0x02, 0x01, 0x06, 0x81, 0x73, 0x65, 0x00, 0x04,
+    0x0F, 0x08, 0x03, 0x1C, 0x82, 0x6F, 0x73, 0x65, 0x73, 0x00, 0x05, 0x12, 0x01, 0x02, 0x0D, 0x05,
+    0x82, 0x72, 0x61, 0x73, 0x73, 0x00, 0x04, 0x12, 0x03, 0x03, 0x01, 0x84, 0x72, 0x6F, 0x73, 0x73,
+    0x00, 0x06, 0x0C, 0x0F, 0x0D, 0x0F, 0x0E, 0x01, 0x84, 0x61, 0x6C, 0x6F, 0x75, 0x73, 0x00, 0x06,
+    0x0E, 0x05, 0x03, 0x0E, 0x0F, 0x03, 0x85, 0x73, 0x65, 0x6E, 0x73, 0x75, 0x73, 0x00, 0x04, 0x05,
+    0x10, 0x05, 0x13, 0x83, 0x61, 0x72, 0x61, 0x74, 0x00, 0x05, 0x08, 0x05, 0x0D, 0x0F, 0x13, 0x83,
+    0x77, 0x68, 0x61, 0x74, 0x00, 0x03, 0x12, 0x07, 0x1C, 0x82, 0x65, 0x61, 0x74, 0x00, 0x07, 0x0D,
+    0x0E, 0x12, 0x05, 0x16, 0x0F, 0x07, 0x82, 0x65, 0x6E, 0x74, 0x00, 0x02, 0x09, 0x17, 0x81, 0x74,
+    0x68, 0x00, 0x04, 0x07, 0x0E, 0x0F, 0x14, 0x83, 0x69, 0x67, 0x68, 0x74, 0x00, 0x05, 0x05, 0x06,
+    0x06, 0x09, 0x04, 0x81, 0x65, 0x6E, 0x74, 0x00, 0x02, 0x0F, 0x03, 0x82, 0x6E, 0x73, 0x74, 0x00,
+    0x03, 0x04, 0x09, 0x04, 0x82, 0x20, 0x6E, 0x6F, 0x74, 0x00, 0x03, 0x10, 0x05, 0x12, 0x82, 0x6F,
+    0x72, 0x74, 0x00, 0x03, 0x0D, 0x0C, 0x01, 0x82, 0x6F, 0x73, 0x74, 0x00, 0x04, 0x09, 0x03, 0x05,
+    0x12, 0x83, 0x65, 0x69, 0x70, 0x74, 0x00, 0x03, 0x03, 0x0E, 0x05, 0x82, 0x72, 0x79, 0x70, 0x74,
+    0x00, 0x03, 0x12, 0x01, 0x0C, 0x81, 0x65, 0x73, 0x74, 0x00, 0x03, 0x0F, 0x0C, 0x01, 0x83, 0x6D,
+    0x6F, 0x73, 0x74, 0x00, 0x03, 0x0A, 0x01, 0x1C, 0x83, 0x64, 0x6A, 0x75, 0x73, 0x74, 0x00, 0x03,
+    0x10, 0x15, 0x0F, 0x83, 0x74, 0x70, 0x75, 0x74, 0x00, 0x02, 0x08, 0x1C, 0x81, 0x76, 0x65, 0x00,
+    0x06, 0x12, 0x03, 0x0F, 0x10, 0x19, 0x08, 0x82, 0x69, 0x73, 0x79, 0x00, 0x05, 0x15, 0x11, 0x05,
+    0x12, 0x06, 0x81, 0x6E, 0x63, 0x79, 0x00, 0x06, 0x12, 0x03, 0x0F, 0x10, 0x19, 0x08, 0x81, 0x73,
+    0x79, 0x00, 0x06, 0x15, 0x12, 0x0B, 0x0E, 0x01, 0x02, 0x81, 0x74, 0x63, 0x79, 0x00, 0x04, 0x07,
+    0x09, 0x0C, 0x13, 0x81, 0x74, 0x6C, 0x79, 0x00, 0x02, 0x09, 0x0C, 0x81, 0x65, 0x6C, 0x79, 0x00,
+    0x04, 0x0D, 0x0F, 0x0E, 0x01, 0x82, 0x61, 0x6C, 0x79, 0x00, 0x05, 0x01, 0x0D, 0x09, 0x12, 0x10,
+    0x81, 0x69, 0x6C, 0x79, 0x00, 0x03, 0x0F, 0x0D, 0x1C, 0x82, 0x6E, 0x65, 0x79, 0x00, 0x04, 0x01,
+    0x0D, 0x0F, 0x03, 0x83, 0x70, 0x61, 0x6E, 0x79, 0x00, 0x04, 0x10, 0x0F, 0x12, 0x10, 0x80, 0x74,
+    0x79, 0x00, 0x05, 0x07, 0x01, 0x14, 0x01, 0x03, 0x84, 0x65, 0x67, 0x6F, 0x72, 0x79, 0x00, 0x05,
+    0x0E, 0x15, 0x03, 0x0F, 0x1C, 0x86, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x72, 0x79, 0x00, 0x02, 0x01,
+    0x13, 0x81, 0x65, 0x74, 0x79, 0x00, 0x03, 0x09, 0x02, 0x01, 0x81, 0x69, 0x74, 0x79, 0x00, 0x05,
+    0x10, 0x05, 0x0F, 0x12, 0x10, 0x84, 0x70, 0x65, 0x72, 0x74, 0x79, 0x00, 0x06, 0x14, 0x1C, 0x05,
+    0x08, 0x14, 0x1C, 0x84, 0x00, 0x07, 0x09, 0x12, 0x17, 0x19, 0x10, 0x0F, 0x03, 0x85, 0x72, 0x69,
+    0x67, 0x68, 0x74, 0x00, 0x06, 0x12, 0x03, 0x0F, 0x10, 0x19, 0x08, 0x80, 0x65, 0x00, 0x03, 0x0C,
+    0x01, 0x1C, 0x83, 0x20, 0x6C, 0x6F, 0x74, 0x00, 0x03, 0x13, 0x0A, 0x1C, 0x83, 0x75, 0x73, 0x74,
+    0x00, 0x01, 0x17, 0x81, 0x63, 0x68, 0x00, 0x02, 0x08, 0x1C, 0x84, 0x77, 0x68, 0x69, 0x63, 0x68,
+    0x00, 0x03, 0x12, 0x15, 0x02, 0x83, 0x69, 0x65, 0x64, 0x00, 0x03, 0x12, 0x05, 0x04, 0x83, 0x69,
+    0x76, 0x65, 0x64, 0x00, 0x03, 0x06, 0x05, 0x12, 0x81, 0x72, 0x65, 0x64, 0x00, 0x02, 0x01, 0x1C,
+    0x80, 0x65, 0x64, 0x00, 0x03, 0x03, 0x03, 0x0F, 0x81, 0x72, 0x65, 0x64, 0x00, 0x04, 0x05, 0x0C,
+    0x05, 0x12, 0x84, 0x61, 0x74, 0x65, 0x64, 0x00, 0x02, 0x0E, 0x09, 0x80, 0x61, 0x64, 0x00, 0x03,
+    0x12, 0x12, 0x01, 0x84, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x01, 0x01, 0x82, 0x6F, 0x75, 0x6E, 0x64,
+    0x00, 0x05, 0x09, 0x13, 0x0E, 0x0F, 0x03, 0x80, 0x65, 0x64, 0x00, 0x01, 0x17, 0x83, 0x65, 0x69,
+    0x72, 0x64, 0x00, 0x05, 0x0C, 0x09, 0x01, 0x16, 0x01, 0x82, 0x62, 0x6C, 0x65, 0x00, 0x02, 0x0F,
+    0x04, 0x82, 0x62, 0x6C, 0x65, 0x00, 0x06, 0x14, 0x05, 0x10, 0x0D, 0x0F, 0x03, 0x83, 0x65, 0x6E,
+    0x63, 0x65, 0x00, 0x03, 0x11, 0x05, 0x13, 0x82, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x04, 0x12, 0x01,
+    0x15, 0x07, 0x82, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x04, 0x0D, 0x0D, 0x0F, 0x03, 0x81, 0x74, 0x65,
+    0x65, 0x00, 0x04, 0x09, 0x0D, 0x0F, 0x03, 0x84, 0x6D, 0x69, 0x74, 0x74, 0x65, 0x65, 0x00, 0x03,
+    0x12, 0x0F, 0x0D, 0x83, 0x74, 0x67, 0x61, 0x67, 0x65, 0x00, 0x02, 0x08, 0x03, 0x83, 0x61, 0x6E,
+    0x67, 0x65, 0x00, 0x02, 0x05, 0x0D, 0x82, 0x73, 0x61, 0x67, 0x65, 0x00, 0x03, 0x0E, 0x01, 0x1C,
+    0x82, 0x20, 0x74, 0x68, 0x65, 0x00, 0x03, 0x0F, 0x12, 0x06, 0x82, 0x20, 0x74, 0x68, 0x65, 0x00,
+    0x02, 0x14, 0x1C, 0x82, 0x20, 0x74, 0x68, 0x65, 0x00, 0x02, 0x01, 0x1C, 0x82, 0x20, 0x74, 0x68,
+    0x65, 0x00, 0x06, 0x01, 0x0C, 0x09, 0x01, 0x16, 0x01, 0x83, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x09,
+    0x01, 0x16, 0x01, 0x82, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x02, 0x05, 0x10, 0x83, 0x6F, 0x70, 0x6C,
+    0x65, 0x00, 0x02, 0x0F, 0x10, 0x84, 0x65, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x03, 0x05, 0x0F, 0x10,
+    0x85, 0x65, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x02, 0x05, 0x02, 0x83, 0x66, 0x6F, 0x72, 0x65, 0x00,
+    0x04, 0x12, 0x05, 0x08, 0x14, 0x83, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x01, 0x06, 0x83, 0x61,
+    0x6C, 0x73, 0x65, 0x00, 0x03, 0x03, 0x05, 0x02, 0x83, 0x61, 0x75, 0x73, 0x65, 0x00, 0x03, 0x13,
+    0x09, 0x0C, 0x84, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x00, 0x03, 0x10, 0x05, 0x12, 0x84, 0x73, 0x70,
+    0x6F, 0x6E, 0x73, 0x65, 0x00, 0x03, 0x01, 0x05, 0x02, 0x84, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00,
+    0x05, 0x0F, 0x10, 0x0F, 0x12, 0x10, 0x84, 0x61, 0x67, 0x61, 0x74, 0x65, 0x00, 0x02, 0x04, 0x15,
+    0x84, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00, 0x02, 0x05, 0x10, 0x84, 0x75, 0x72, 0x73, 0x75, 0x65,
+    0x00, 0x03, 0x0C, 0x05, 0x02, 0x83, 0x69, 0x65, 0x76, 0x65, 0x00, 0x02, 0x05, 0x02, 0x81, 0x65,
+    0x76, 0x65, 0x00, 0x02, 0x12, 0x10, 0x82, 0x76, 0x65, 0x00, 0x02, 0x02, 0x01, 0x83, 0x6F, 0x76,
+    0x65, 0x00, 0x01, 0x03, 0x82, 0x69, 0x65, 0x66, 0x00, 0x02, 0x05, 0x02, 0x82, 0x69, 0x65, 0x66,
+    0x00, 0x01, 0x02, 0x82, 0x69, 0x65, 0x66, 0x00, 0x04, 0x14, 0x03, 0x01, 0x0D, 0x85, 0x74, 0x63,
+    0x68, 0x69, 0x6E, 0x67, 0x00, 0x03, 0x05, 0x09, 0x03, 0x85, 0x65, 0x69, 0x6C, 0x69, 0x6E, 0x67,
+    0x00, 0x04, 0x15, 0x03, 0x05, 0x12, 0x82, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x04, 0x14, 0x19, 0x0E,
+    0x01, 0x83, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x03, 0x12, 0x14, 0x13, 0x82, 0x6E, 0x67, 0x74, 0x68,
+    0x00, 0x02, 0x05, 0x08, 0x81, 0x68, 0x74, 0x00, 0x02, 0x0E, 0x09, 0x81, 0x69, 0x61, 0x6C, 0x00,
+    0x03, 0x12, 0x09, 0x16, 0x83, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x02, 0x01, 0x1C, 0x82, 0x6E, 0x75,
+    0x61, 0x6C, 0x00, 0x04, 0x15, 0x14, 0x01, 0x0E, 0x82, 0x61, 0x6C, 0x00, 0x02, 0x09, 0x16, 0x83,
+    0x72, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x02, 0x0F, 0x1C, 0x84, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x00,
+    0x05, 0x01, 0x12, 0x12, 0x01, 0x10, 0x85, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x00, 0x02, 0x01, 0x1C,
+    0x82, 0x61, 0x69, 0x6E, 0x00, 0x02, 0x05, 0x02, 0x83, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x01,
+    0x14, 0x81, 0x6E, 0x67, 0x00, 0x02, 0x0C, 0x01, 0x83, 0x69, 0x67, 0x6E, 0x00, 0x04, 0x12, 0x01,
+    0x05, 0x0C, 0x81, 0x6E, 0x67, 0x00, 0x02, 0x07, 0x1C, 0x81, 0x6E, 0x67, 0x00, 0x02, 0x14, 0x13,
+    0x81, 0x6E, 0x67, 0x00, 0x02, 0x01, 0x1C, 0x82, 0x73, 0x69, 0x67, 0x6E, 0x00, 0x01, 0x14, 0x81,
+    0x6E, 0x6B, 0x00, 0x02, 0x08, 0x1C, 0x84, 0x74, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x04, 0x09, 0x13,
+    0x05, 0x04, 0x85, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x04, 0x0D, 0x0D, 0x09, 0x13, 0x84,
+    0x69, 0x6C, 0x61, 0x72, 0x00, 0x05, 0x03, 0x09, 0x14, 0x01, 0x10, 0x86, 0x72, 0x74, 0x69, 0x63,
+    0x75, 0x6C, 0x61, 0x72, 0x00, 0x03, 0x09, 0x05, 0x08, 0x85, 0x69, 0x67, 0x68, 0x65, 0x72, 0x00,
+    0x02, 0x14, 0x1C, 0x82, 0x65, 0x69, 0x72, 0x00, 0x04, 0x10, 0x0D, 0x0F, 0x03, 0x83, 0x69, 0x6C,
+    0x65, 0x72, 0x00, 0x04, 0x07, 0x07, 0x05, 0x02, 0x84, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x00, 0x03,
+    0x0F, 0x0E, 0x01, 0x83, 0x74, 0x68, 0x65, 0x72, 0x00, 0x04, 0x10, 0x0F, 0x0D, 0x03, 0x86, 0x6F,
+    0x6D, 0x70, 0x75, 0x74, 0x65, 0x72, 0x00, 0x05, 0x05, 0x12, 0x05, 0x08, 0x17, 0x83, 0x76, 0x65,
+    0x72, 0x00, 0x02, 0x0F, 0x08, 0x82, 0x65, 0x76, 0x65, 0x72, 0x00, 0x02, 0x09, 0x1C, 0x82, 0x65,
+    0x61, 0x73, 0x00, 0x01, 0x14, 0x83, 0x61, 0x6B, 0x65, 0x73, 0x00, 0x06, 0x0F, 0x13, 0x05, 0x03,
+    0x03, 0x01, 0x84, 0x73, 0x6F, 0x72, 0x69, 0x65, 0x73, 0x00, 0x04, 0x0C, 0x09, 0x02, 0x01, 0x83,
+    0x69, 0x74, 0x69, 0x65, 0x73, 0x00, 0x02, 0x05, 0x0C, 0x81, 0x74, 0x68, 0x00, 0x04, 0x0F, 0x12,
+    0x08, 0x14, 0x85, 0x6F, 0x75, 0x67, 0x68, 0x74, 0x00, 0x05, 0x10, 0x09, 0x03, 0x05, 0x12, 0x82,
+    0x65, 0x6E, 0x74, 0x00, 0x05, 0x09, 0x0D, 0x0F, 0x12, 0x10, 0x82, 0x65, 0x6E, 0x74, 0x00, 0x04,
+    0x01, 0x10, 0x10, 0x01, 0x82, 0x65, 0x6E, 0x74, 0x00, 0x05, 0x05, 0x10, 0x0D, 0x0F, 0x03, 0x82,
+    0x65, 0x6E, 0x74, 0x00, 0x04, 0x05, 0x0C, 0x05, 0x12, 0x82, 0x61, 0x6E, 0x74, 0x00, 0x05, 0x09,
+    0x0E, 0x07, 0x0F, 0x03, 0x82, 0x61, 0x6E, 0x74, 0x00, 0x03, 0x14, 0x0E, 0x09, 0x83, 0x65, 0x72,
+    0x65, 0x73, 0x74, 0x00, 0x04, 0x05, 0x0E, 0x01, 0x0D, 0x84, 0x69, 0x66, 0x65, 0x73, 0x74, 0x00,
+    0x03, 0x01, 0x07, 0x01, 0x83, 0x69, 0x6E, 0x73, 0x74, 0x00, 0x03, 0x09, 0x07, 0x01, 0x84, 0x61,
+    0x69, 0x6E, 0x73, 0x74, 0x00, 0x04, 0x09, 0x01, 0x07, 0x01, 0x82, 0x73, 0x74, 0x00, 0x03, 0x03,
+    0x18, 0x05, 0x84, 0x65, 0x63, 0x75, 0x74, 0x00, 0x02, 0x09, 0x03, 0x80, 0x69, 0x74, 0x00, 0x01,
+    0x02, 0x84, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x02, 0x02, 0x01, 0x83, 0x6F, 0x75, 0x74, 0x00,
+    0x02, 0x0E, 0x09, 0x83, 0x70, 0x75, 0x74, 0x00, 0x01, 0x0F, 0x82, 0x74, 0x70, 0x75, 0x74, 0x00,
+    0x02, 0x05, 0x12, 0x82, 0x65, 0x69, 0x76, 0x00, 0x03, 0x03, 0x05, 0x12, 0x81, 0x76, 0x00, 0x03,
+    0x0F, 0x12, 0x10, 0x81, 0x62, 0x6C, 0x79, 0x00, 0x01, 0x12, 0x80, 0x6C, 0x79, 0x00, 0x02, 0x05,
+    0x12, 0x83, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x02, 0x09, 0x06, 0x80, 0x6C, 0x79, 0x00, 0x04, 0x05,
+    0x0E, 0x05, 0x07, 0x80, 0x6C, 0x79, 0x00, 0x03, 0x14, 0x03, 0x01, 0x80, 0x6C, 0x79, 0x00, 0x05,
+    0x01, 0x02, 0x0F, 0x12, 0x10, 0x81, 0x79, 0x00, 0x02, 0x01, 0x12, 0x84, 0x65, 0x61, 0x6C, 0x6C,
+    0x79, 0x00, 0x02, 0x09, 0x0C, 0x82, 0x72, 0x61, 0x72, 0x79, 0x00, 0x06, 0x0C, 0x0C, 0x09, 0x18,
+    0x15, 0x01, 0x84, 0x69, 0x61, 0x72, 0x79, 0x00, 0x02, 0x15, 0x13, 0x82, 0x6D, 0x61, 0x72, 0x79,
+    0x00, 0x05, 0x03, 0x0F, 0x10, 0x19, 0x08, 0x82, 0x69, 0x73, 0x79, 0x00, 0x02, 0x0C, 0x01, 0x81,
+    0x79, 0x73, 0x00, 0x00, 0x83, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x04, 0x0E, 0x09, 0x01, 0x0D, 0x81,
+    0x61, 0x6E, 0x63, 0x65, 0x00, 0x01, 0x1C, 0x82, 0x20, 0x74, 0x68, 0x65, 0x00, 0x03, 0x0F, 0x02,
+    0x01, 0x82, 0x20, 0x74, 0x68, 0x65, 0x00, 0x03, 0x09, 0x0C, 0x05, 0x83, 0x69, 0x62, 0x6C, 0x65,
+    0x00, 0x02, 0x0D, 0x01, 0x82, 0x65, 0x75, 0x72, 0x00, 0x00, 0x82, 0x72, 0x75, 0x65, 0x00, 0x03,
+    0x03, 0x05, 0x02, 0x84, 0x61, 0x75, 0x73, 0x65, 0x00, 0x03, 0x03, 0x01, 0x02, 0x86, 0x65, 0x63,
+    0x61, 0x75, 0x73, 0x65, 0x00, 0x04, 0x15, 0x0C, 0x01, 0x03, 0x85, 0x63, 0x75, 0x6C, 0x61, 0x74,
+    0x65, 0x00, 0x04, 0x0D, 0x01, 0x05, 0x14, 0x86, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0x00, 0x03,
+    0x0E, 0x01, 0x07, 0x86, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x00, 0x02, 0x03, 0x01, 0x84,
+    0x63, 0x75, 0x72, 0x61, 0x74, 0x65, 0x00, 0x01, 0x02, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x03, 0x03,
+    0x01, 0x03, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x00, 0x81, 0x6C, 0x64, 0x00, 0x01, 0x13, 0x81, 0x6C,
+    0x64, 0x00, 0x03, 0x0C, 0x15, 0x06, 0x84, 0x66, 0x69, 0x6C, 0x6C, 0x00, 0x01, 0x06, 0x83, 0x6C,
+    0x66, 0x69, 0x6C, 0x6C, 0x00, 0x02, 0x0F, 0x03, 0x82, 0x61, 0x69, 0x6E, 0x00, 0x02, 0x05, 0x03,
+    0x82, 0x61, 0x69, 0x6E, 0x00, 0x01, 0x02, 0x82, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x02, 0x05, 0x02,
+    0x84, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x02, 0x09, 0x0C, 0x83, 0x69, 0x73, 0x6F, 0x6E, 0x00,
+    0x04, 0x01, 0x03, 0x03, 0x0F, 0x83, 0x69, 0x6F, 0x6E, 0x00, 0x04, 0x12, 0x05, 0x02, 0x01, 0x84,
+    0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x02, 0x04, 0x01, 0x83, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x05, 0x14, 0x09, 0x10, 0x05, 0x12, 0x86, 0x65, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00,
+    0x03, 0x01, 0x05, 0x12, 0x85, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x03, 0x03, 0x15, 0x06,
+    0x85, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x02, 0x0F, 0x10, 0x83, 0x69, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x04, 0x08, 0x07, 0x0F, 0x14, 0x85, 0x65, 0x74, 0x68, 0x65, 0x72, 0x00, 0x02, 0x0F,
+    0x1C, 0x84, 0x74, 0x68, 0x65, 0x72, 0x00, 0x01, 0x06, 0x83, 0x72, 0x74, 0x68, 0x65, 0x72, 0x00,
+    0x02, 0x0F, 0x10, 0x83, 0x6E, 0x74, 0x65, 0x72, 0x00, 0x02, 0x09, 0x0C, 0x82, 0x65, 0x6E, 0x65,
+    0x72, 0x00, 0x03, 0x04, 0x0E, 0x09, 0x84, 0x69, 0x63, 0x65, 0x73, 0x00, 0x03, 0x0F, 0x12, 0x10,
+    0x83, 0x65, 0x73, 0x73, 0x00, 0x01, 0x13, 0x82, 0x63, 0x65, 0x73, 0x73, 0x00, 0x04, 0x13, 0x13,
+    0x15, 0x02, 0x85, 0x69, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x02, 0x15, 0x02, 0x83, 0x69, 0x6E, 0x65,
+    0x73, 0x73, 0x00, 0x03, 0x03, 0x15, 0x13, 0x83, 0x65, 0x73, 0x73, 0x00, 0x01, 0x10, 0x82, 0x73,
+    0x65, 0x73, 0x73, 0x00, 0x04, 0x05, 0x06, 0x06, 0x05, 0x85, 0x69, 0x63, 0x69, 0x65, 0x6E, 0x74,
+    0x00, 0x04, 0x05, 0x03, 0x05, 0x12, 0x85, 0x69, 0x70, 0x69, 0x65, 0x6E, 0x74, 0x00, 0x03, 0x16,
+    0x0F, 0x07, 0x83, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x03, 0x01, 0x14, 0x13, 0x83, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x00, 0x02, 0x10, 0x01, 0x84, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00,
+    0x03, 0x06, 0x09, 0x04, 0x84, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x03, 0x06, 0x09, 0x04,
+    0x83, 0x65, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x01, 0x08, 0x82, 0x68, 0x65, 0x73, 0x74, 0x00, 0x01,
+    0x13, 0x82, 0x67, 0x65, 0x73, 0x74, 0x00, 0x03, 0x15, 0x03, 0x01, 0x85, 0x74, 0x75, 0x61, 0x6C,
+    0x6C, 0x79, 0x00, 0x03, 0x18, 0x15, 0x01, 0x82, 0x69, 0x61, 0x72, 0x79, 0x00, 0x04, 0x09, 0x18,
+    0x15, 0x01, 0x83, 0x69, 0x61, 0x72, 0x79, 0x00, 0x01, 0x0C, 0x84, 0x6E, 0x67, 0x75, 0x61, 0x67,
+    0x65, 0x00, 0x00, 0x83, 0x61, 0x75, 0x67, 0x65, 0x00, 0x00, 0x83, 0x6C, 0x65, 0x67, 0x65, 0x00,
+    0x04, 0x16, 0x09, 0x12, 0x10, 0x82, 0x67, 0x65, 0x00, 0x01, 0x01, 0x82, 0x67, 0x65, 0x00, 0x02,
+    0x16, 0x01, 0x84, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x02, 0x16, 0x01, 0x85, 0x61, 0x69,
+    0x6C, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x15, 0x0C, 0x01, 0x03, 0x86, 0x63, 0x75, 0x6C, 0x61,
+    0x74, 0x65, 0x00, 0x02, 0x01, 0x03, 0x84, 0x63, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x00, 0x01, 0x02,
+    0x82, 0x75, 0x73, 0x65, 0x00, 0x00, 0x82, 0x75, 0x73, 0x65, 0x00, 0x01, 0x10, 0x81, 0x6C, 0x65,
+    0x6C, 0x00, 0x02, 0x01, 0x10, 0x84, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x00, 0x02, 0x0E, 0x09, 0x82,
+    0x65, 0x73, 0x00, 0x03, 0x12, 0x05, 0x16, 0x82, 0x65, 0x73, 0x00, 0x02, 0x15, 0x13, 0x85, 0x70,
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x00, 0x01, 0x13, 0x83, 0x70, 0x72, 0x65, 0x73, 0x73, 0x00, 0x03,
+    0x16, 0x0F, 0x07, 0x84, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x0F, 0x16, 0x0F, 0x07,
+    0x86, 0x65, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x03, 0x16, 0x0F, 0x07, 0x83, 0x6E, 0x6D,
+    0x65, 0x6E, 0x74, 0x00, 0x03, 0x16, 0x0F, 0x07, 0x85, 0x65, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+    0x00, 0x03, 0x06, 0x09, 0x04, 0x85, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x02, 0x12, 0x1C,
+    0x86, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x02, 0x0F, 0x14, 0x83, 0x61, 0x6E,
+    0x63, 0x65, 0x00, 0x00, 0x82, 0x72, 0x69, 0x64, 0x65, 0x00, 0x01, 0x0F, 0x85, 0x65, 0x72, 0x72,
+    0x69, 0x64, 0x65, 0x00, 0x01, 0x07, 0x86, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65, 0x65, 0x00,
+    0x02, 0x01, 0x07, 0x87, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x02, 0x16, 0x01,
+    0x85, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x03, 0x01, 0x16, 0x01, 0x84, 0x61, 0x62, 0x6C,
+    0x65, 0x00, 0x03, 0x0F, 0x03, 0x01, 0x87, 0x63, 0x6F, 0x6D, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65,
+    0x00, 0x03, 0x03, 0x03, 0x01, 0x84, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x01, 0x15, 0x84,
+    0x61, 0x6C, 0x6C, 0x79, 0x00, 0x00, 0x83, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x02, 0x05, 0x0E,
+    0x85, 0x65, 0x73, 0x73, 0x61, 0x72, 0x79, 0x00, 0x01, 0x0E, 0x82, 0x73, 0x61, 0x72, 0x79, 0x00,
+    0x00, 0x85, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x01, 0x01, 0x83, 0x65, 0x6E, 0x74, 0x00
+};
@@ -0,0 +1,64 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include "keycode.h"
+#include "test_common.hpp"
+
+#if __has_include("autocorrect_data.h")
+#    include "autocorrect_data.h"
+#else
+#    include "autocorrect_data_default.h"
+#endif
+
+using ::testing::_;
+using ::testing::AnyNumber;
+
+#ifdef AUTOCORRECT_DOUBLE_ARRAY_SIZE
+static const char  *autocorrect_format     = "double-array";
+static const size_t autocorrect_flash_size = sizeof(autocorrect_base) + sizeof(autocorrect_check) + sizeof(autocorrect_corrections);
+#else
+static const char  *autocorrect_format     = "trie";
+static const size_t autocorrect_flash_size = sizeof(autocorrect_data);
+#endif
+
+class AutoCorrectBenchmark : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+    }
+};
+
+/* Feeds correctly spelled text straight into process_autocorrect(), so that
+ * every key is a lookup that walks the trie until it runs out of matches, and
+ * prints the cost per key next to the size of the dictionary. Builds with the
+ * same dictionary in the two formats can be compared line by line. */
+TEST_F(AutoCorrectBenchmark, lookup_cost) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    const char *text = "the quick brown fox jumps over a lazy dog while seven wizards hex a jolly quartz box and a "
+                       "mean sphinx of black quartz judges their vow before breakfast ";
+
+    std::vector<uint16_t> keycodes;
+    for (const char *c = text; *c; ++c) {
+        keycodes.push_back(*c == ' ' ? KC_SPC : KC_A + (*c - 'a'));
+    }
+
+    keyrecord_t record   = {};
+    record.event.pressed = true;
+
+    const int  rounds = 2000;
+    const auto start  = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (uint16_t keycode : keycodes) {
+            process_autocorrect(keycode, &record);
+        }
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    printf("\nautocorrect %-12s  %6zu bytes  %4d..%d chars  %6.1f ns per key\n\n", autocorrect_format, autocorrect_flash_size, AUTOCORRECT_MIN_LENGTH, AUTOCORRECT_MAX_LENGTH, (double)elapsed / (rounds * keycodes.size()));
+
+    VERIFY_AND_CLEAR(driver);
+}
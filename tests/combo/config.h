@@ -6,3 +6,4 @@
 #include "test_common.h"
 
 #define TAPPING_TERM 200
+#define COMBO_SHOULD_TRIGGER
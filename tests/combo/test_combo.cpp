@@ -13,7 +13,14 @@
 using testing::_;
 using testing::InSequence;
 
-class Combo : public TestFixture {};
+extern "C" bool reject_a_for_ab;
+
+class Combo : public TestFixture {
+   public:
+    ~Combo() {
+        reject_a_for_ab = false;
+    }
+};
 
 TEST_F(Combo, combo_modtest_tapped) {
     TestDriver driver;
@@ -55,3 +62,118 @@ TEST_F(Combo, combo_osmshift_tapped) {
     tap_key(key_i);
     VERIFY_AND_CLEAR(driver);
 }
+
+TEST_F(Combo, combo_overlapping_longest_wins) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 1, KC_A);
+    KeymapKey  key_b(0, 0, 2, KC_B);
+    KeymapKey  key_c(0, 0, 3, KC_C);
+    set_keymap({key_a, key_b, key_c});
+
+    EXPECT_REPORT(driver, (KC_W));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_c, key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Combo, combo_overlapping_shorter_alone) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 1, KC_A);
+    KeymapKey  key_b(0, 0, 2, KC_B);
+    KeymapKey  key_c(0, 0, 3, KC_C);
+    set_keymap({key_a, key_b, key_c});
+
+    EXPECT_REPORT(driver, (KC_V));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_b, key_a});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Combo, combo_held_released_in_press_order) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 1, KC_A);
+    KeymapKey  key_b(0, 0, 2, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_V));
+    key_a.press();
+    run_one_scan_loop();
+    key_b.press();
+    idle_for(COMBO_TERM * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    // The combo is held until its last key is released
+    EXPECT_NO_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Combo, combo_key_held_past_term_is_sent) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 1, KC_A);
+    KeymapKey  key_b(0, 0, 2, KC_B);
+    set_keymap({key_a, key_b});
+
+    // The combo timer can't start at time 0
+    idle_for(1);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    idle_for(COMBO_TERM * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    // Too late for the combo, so B is a plain key
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key_b.press();
+    idle_for(COMBO_TERM * 2);
+    key_b.release();
+    run_one_scan_loop();
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Combo, combo_incomplete_chord_is_sent) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 1, KC_A);
+    KeymapKey  key_c(0, 0, 3, KC_C);
+    set_keymap({key_a, key_c});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_C));
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_c});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Combo, combo_rejected_key_press_is_not_part_of_the_chord) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 1, KC_A);
+    KeymapKey  key_b(0, 0, 2, KC_B);
+    set_keymap({key_a, key_b});
+
+    // A is rejected for the ab combo when pressed, so B alone can't complete it
+    reject_a_for_ab = true;
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+
+    // Pressed again while accepted, A is part of the chord once more
+    reject_a_for_ab = false;
+    EXPECT_REPORT(driver, (KC_V));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
@@ -4,14 +4,24 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 #include "quantum.h"
 
-enum combos { modtest, osmshift };
+enum combos { modtest, osmshift, ab, abc };
 
 uint16_t const modtest_combo[]  = {KC_Y, KC_U, COMBO_END};
 uint16_t const osmshift_combo[] = {KC_Z, KC_X, COMBO_END};
+uint16_t const ab_combo[]       = {KC_A, KC_B, COMBO_END};
+uint16_t const abc_combo[]      = {KC_A, KC_B, KC_C, COMBO_END};
 
 // clang-format off
 combo_t key_combos[] = {
     [modtest]  = COMBO(modtest_combo, RSFT_T(KC_SPACE)),
-    [osmshift] = COMBO(osmshift_combo, OSM(MOD_LSFT))
+    [osmshift] = COMBO(osmshift_combo, OSM(MOD_LSFT)),
+    [ab]       = COMBO(ab_combo, KC_V),
+    [abc]      = COMBO(abc_combo, KC_W)
 };
 // clang-format on
+
+bool reject_a_for_ab = false;
+
+bool combo_should_trigger(uint16_t combo_index, combo_t *combo, uint16_t keycode, keyrecord_t *record) {
+    return !(reject_a_for_ab && combo_index == ab && keycode == KC_A);
+}
@@ -0,0 +1,114 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+}
+
+static uint16_t active_combo_count = combo_count_raw();
+
+// Stands in for combos that are enabled or loaded at runtime
+extern "C" uint16_t combo_count(void) {
+    return active_combo_count;
+}
+
+class ComboKeycodeIndex : public TestFixture {
+   protected:
+    void TearDown() override {
+        active_combo_count = combo_count_raw();
+        combo_index_clear();
+        TestFixture::TearDown();
+    }
+};
+
+TEST_F(ComboKeycodeIndex, ChordFiresCombo) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, LongestOverlappingComboWins) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 1, 0, KC_B);
+    KeymapKey  key_c(0, 2, 0, KC_C);
+    set_keymap({key_a, key_b, key_c});
+
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b, key_c});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, KeysInAnyOrder) {
+    TestDriver driver;
+    KeymapKey  key_c(0, 2, 0, KC_C);
+    KeymapKey  key_d(0, 3, 0, KC_D);
+    set_keymap({key_c, key_d});
+
+    EXPECT_REPORT(driver, (KC_Z));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_c, key_d});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, LongCombo) {
+    TestDriver driver;
+    KeymapKey  key_f1(0, 0, 1, KC_F1);
+    KeymapKey  key_f2(0, 1, 1, KC_F2);
+    KeymapKey  key_f3(0, 2, 1, KC_F3);
+    KeymapKey  key_f4(0, 3, 1, KC_F4);
+    KeymapKey  key_f5(0, 4, 1, KC_F5);
+    KeymapKey  key_f6(0, 5, 1, KC_F6);
+    KeymapKey  key_f7(0, 6, 1, KC_F7);
+    KeymapKey  key_f8(0, 7, 1, KC_F8);
+    set_keymap({key_f1, key_f2, key_f3, key_f4, key_f5, key_f6, key_f7, key_f8});
+
+    EXPECT_REPORT(driver, (KC_F12));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_f8, key_f1, key_f7, key_f2, key_f6, key_f3, key_f5, key_f4});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, KeyOutsideCombosIsNotDelayed) {
+    TestDriver driver;
+    KeymapKey  key_e(0, 4, 0, KC_E);
+    set_keymap({key_e});
+
+    EXPECT_REPORT(driver, (KC_E));
+    key_e.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_e.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, ClearFollowsComboCount) {
+    TestDriver driver;
+    KeymapKey  key_c(0, 2, 0, KC_C);
+    KeymapKey  key_d(0, 3, 0, KC_D);
+    set_keymap({key_c, key_d});
+
+    // Once the index is rebuilt without the last two combos, C and D are plain keys again
+    active_combo_count = 2;
+    combo_index_clear();
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_REPORT(driver, (KC_C, KC_D));
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_c, key_d});
+    VERIFY_AND_CLEAR(driver);
+}
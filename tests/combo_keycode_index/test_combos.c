@@ -0,0 +1,19 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { ab, abc, dc, function_keys };
+
+uint16_t const ab_combo[]            = {KC_A, KC_B, COMBO_END};
+uint16_t const abc_combo[]           = {KC_A, KC_B, KC_C, COMBO_END};
+uint16_t const dc_combo[]            = {KC_D, KC_C, COMBO_END};
+uint16_t const function_keys_combo[] = {KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [ab]            = COMBO(ab_combo, KC_X),
+    [abc]           = COMBO(abc_combo, KC_Y),
+    [dc]            = COMBO(dc_combo, KC_Z),
+    [function_keys] = COMBO(function_keys_combo, KC_F12),
+};
+// clang-format on
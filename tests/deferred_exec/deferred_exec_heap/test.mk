@@ -0,0 +1,7 @@
+# Copyright 2023 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+DEFERRED_EXEC_ENABLE = yes
+TASK_SCHEDULER_ENABLE = yes
+
+SRC += ../test_deferred_exec.cpp
@@ -0,0 +1,74 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+constexpr size_t LARGE_TABLE_SIZE = 4096;
+
+deferred_executor_t   large_table[LARGE_TABLE_SIZE];
+std::vector<uint32_t> large_triggers;
+std::vector<uint16_t> large_runs;
+
+uint32_t large_callback(uint32_t trigger_time, void *cb_arg) {
+    large_triggers.push_back(trigger_time);
+    large_runs[(uintptr_t)cb_arg]++;
+    return 0;
+}
+
+} // namespace
+
+class DeferredExecHeap : public TestFixture {};
+
+TEST_F(DeferredExecHeap, thousands_of_executors) {
+    deferred_exec_state_t       state = {};
+    std::vector<deferred_token> tokens(LARGE_TABLE_SIZE);
+    std::vector<uint32_t>       expected_trigger(LARGE_TABLE_SIZE);
+    large_runs.assign(LARGE_TABLE_SIZE, 0);
+
+    auto start = std::chrono::steady_clock::now();
+
+    /* Fill the table with pseudo random delays, then cancel and extend some of them. */
+    uint32_t seed = 1;
+    for (size_t i = 0; i < LARGE_TABLE_SIZE; i++) {
+        seed                = seed * 1103515245 + 12345;
+        expected_trigger[i] = 1 + (seed >> 16) % 1000;
+        tokens[i]           = defer_exec_advanced(large_table, LARGE_TABLE_SIZE, expected_trigger[i], large_callback, (void *)i);
+        ASSERT_NE(tokens[i], INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer_exec_advanced(large_table, LARGE_TABLE_SIZE, 1, large_callback, NULL), INVALID_DEFERRED_TOKEN);
+
+    for (size_t i = 0; i < LARGE_TABLE_SIZE; i += 3) {
+        EXPECT_TRUE(cancel_deferred_exec_advanced(large_table, LARGE_TABLE_SIZE, tokens[i]));
+    }
+    for (size_t i = 1; i < LARGE_TABLE_SIZE; i += 3) {
+        expected_trigger[i] = 500 + i % 700;
+        EXPECT_TRUE(extend_deferred_exec_advanced(large_table, LARGE_TABLE_SIZE, tokens[i], expected_trigger[i]));
+    }
+
+    for (uint32_t ms = 0; ms < 1200; ms++) {
+        advance_time(1);
+        deferred_exec_advanced_task(large_table, LARGE_TABLE_SIZE, &state);
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    std::cout << LARGE_TABLE_SIZE << " executors queued and run in " << elapsed << "us" << std::endl;
+
+    /* Every remaining executor ran exactly once, at its own trigger time and in trigger order. */
+    for (size_t i = 0; i < LARGE_TABLE_SIZE; i++) {
+        EXPECT_EQ(large_runs[i], i % 3 == 0 ? 0 : 1) << "executor " << i;
+    }
+    EXPECT_EQ(large_triggers.size(), LARGE_TABLE_SIZE - (LARGE_TABLE_SIZE + 2) / 3);
+    EXPECT_TRUE(std::is_sorted(large_triggers.begin(), large_triggers.end()));
+    EXPECT_EQ(deferred_exec_advanced_next_deadline(large_table, LARGE_TABLE_SIZE), UINT32_MAX);
+}
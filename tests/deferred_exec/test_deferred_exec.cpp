@@ -0,0 +1,276 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "task_scheduler.h"
+
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+struct invocation_t {
+    uintptr_t id;
+    uint32_t  trigger_time;
+};
+
+std::vector<invocation_t> invocations;
+uint32_t                  repeat_delay[4];
+
+uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    uintptr_t id = (uintptr_t)cb_arg;
+    invocations.push_back({id, trigger_time});
+    return repeat_delay[id];
+}
+
+} // namespace
+
+class DeferredExec : public TestFixture {
+   public:
+    static constexpr size_t TABLE_SIZE = 4;
+
+    deferred_executor_t   table[TABLE_SIZE] = {};
+    deferred_exec_state_t state             = {};
+
+    DeferredExec() {
+        invocations.clear();
+        memset(repeat_delay, 0, sizeof(repeat_delay));
+    }
+
+    deferred_token defer(uint32_t delay_ms, uintptr_t id) {
+        return defer_exec_advanced(table, TABLE_SIZE, delay_ms, record_callback, (void *)id);
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, TABLE_SIZE, &state);
+        }
+    }
+
+    std::vector<uintptr_t> invoked_ids() {
+        std::vector<uintptr_t> ids;
+        for (auto &invocation : invocations) {
+            ids.push_back(invocation.id);
+        }
+        return ids;
+    }
+};
+
+TEST_F(DeferredExec, executes_in_trigger_order) {
+    EXPECT_NE(defer(30, 0), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer(10, 1), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer(20, 2), INVALID_DEFERRED_TOKEN);
+
+    run_for(9);
+    EXPECT_TRUE(invocations.empty());
+
+    run_for(30);
+    EXPECT_EQ(invoked_ids(), (std::vector<uintptr_t>{1, 2, 0}));
+    EXPECT_EQ(invocations[0].trigger_time, 10);
+    EXPECT_EQ(invocations[1].trigger_time, 20);
+    EXPECT_EQ(invocations[2].trigger_time, 30);
+    EXPECT_EQ(deferred_exec_advanced_next_deadline(table, TABLE_SIZE), UINT32_MAX);
+}
+
+TEST_F(DeferredExec, repeats_relative_to_previous_trigger) {
+    repeat_delay[0] = 5;
+    EXPECT_NE(defer(10, 0), INVALID_DEFERRED_TOKEN);
+
+    run_for(20);
+    ASSERT_EQ(invocations.size(), 3);
+    EXPECT_EQ(invocations[0].trigger_time, 10);
+    EXPECT_EQ(invocations[1].trigger_time, 15);
+    EXPECT_EQ(invocations[2].trigger_time, 20);
+
+    repeat_delay[0] = 0;
+    run_for(5);
+    EXPECT_EQ(invocations.size(), 4);
+    run_for(20);
+    EXPECT_EQ(invocations.size(), 4);
+    EXPECT_EQ(deferred_exec_advanced_next_deadline(table, TABLE_SIZE), UINT32_MAX);
+}
+
+TEST_F(DeferredExec, extend_and_cancel) {
+    deferred_token first  = defer(10, 0);
+    deferred_token second = defer(20, 1);
+
+    run_for(5);
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, TABLE_SIZE, first, 30));
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, TABLE_SIZE, second));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, TABLE_SIZE, second));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, TABLE_SIZE, second, 30));
+
+    run_for(50);
+    ASSERT_EQ(invocations.size(), 1);
+    EXPECT_EQ(invocations[0].id, 0);
+    EXPECT_EQ(invocations[0].trigger_time, 35);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, TABLE_SIZE, first));
+}
+
+TEST_F(DeferredExec, full_table_and_stale_tokens) {
+    deferred_token tokens[TABLE_SIZE];
+    for (size_t i = 0; i < TABLE_SIZE; i++) {
+        tokens[i] = defer(10 + i, i);
+        EXPECT_NE(tokens[i], INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer(10, 0), INVALID_DEFERRED_TOKEN);
+
+    /* A new executor reuses the freed slot, but not the cancelled token. */
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, TABLE_SIZE, tokens[1]));
+    deferred_token reused = defer(5, 1);
+    EXPECT_NE(reused, INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(reused, tokens[1]);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, TABLE_SIZE, tokens[1]));
+
+    run_for(20);
+    EXPECT_EQ(invoked_ids(), (std::vector<uintptr_t>{1, 0, 2, 3}));
+    EXPECT_EQ(invocations[0].trigger_time, 5);
+}
+
+TEST_F(DeferredExec, rejects_invalid_requests) {
+    EXPECT_EQ(defer(0, 0), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(table, TABLE_SIZE, 10, NULL, NULL), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(NULL, TABLE_SIZE, 10, record_callback, NULL), INVALID_DEFERRED_TOKEN);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, TABLE_SIZE, INVALID_DEFERRED_TOKEN));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, TABLE_SIZE, INVALID_DEFERRED_TOKEN, 10));
+}
+
+TEST_F(DeferredExec, next_deadline) {
+    EXPECT_EQ(deferred_exec_advanced_next_deadline(table, TABLE_SIZE), UINT32_MAX);
+
+    defer(10, 0);
+    defer(25, 1);
+    EXPECT_EQ(deferred_exec_advanced_next_deadline(table, TABLE_SIZE), 10);
+
+    advance_time(4);
+    EXPECT_EQ(deferred_exec_advanced_next_deadline(table, TABLE_SIZE), 6);
+
+    advance_time(10);
+    EXPECT_EQ(deferred_exec_advanced_next_deadline(table, TABLE_SIZE), 0);
+
+    deferred_exec_advanced_task(table, TABLE_SIZE, &state);
+    EXPECT_EQ(deferred_exec_advanced_next_deadline(table, TABLE_SIZE), 11);
+}
+
+TEST_F(DeferredExec, executor_running_behind_runs_once_per_run) {
+    repeat_delay[0] = 1;
+    EXPECT_NE(defer(1, 0), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer(30, 1), INVALID_DEFERRED_TOKEN);
+
+    /* Still due after being requeued, but left for the next run. */
+    advance_time(10);
+    deferred_exec_advanced_task(table, TABLE_SIZE, &state);
+    ASSERT_EQ(invocations.size(), 1);
+    EXPECT_EQ(invocations[0].trigger_time, 1);
+    EXPECT_EQ(deferred_exec_advanced_next_deadline(table, TABLE_SIZE), 0);
+
+    run_for(1);
+    ASSERT_EQ(invocations.size(), 2);
+    EXPECT_EQ(invocations[1].trigger_time, 2);
+}
+
+namespace {
+
+deferred_executor_t *chain_table;
+uintptr_t            chained_id;
+
+uint32_t chain_callback(uint32_t trigger_time, void *cb_arg) {
+    invocations.push_back({(uintptr_t)cb_arg, trigger_time});
+    defer_exec_advanced(chain_table, DeferredExec::TABLE_SIZE, 1, record_callback, (void *)chained_id);
+    return 0;
+}
+
+} // namespace
+
+TEST_F(DeferredExec, callback_queues_another_executor) {
+    chain_table = table;
+    chained_id  = 1;
+    defer_exec_advanced(table, TABLE_SIZE, 10, chain_callback, (void *)0);
+    defer(12, 2);
+
+    run_for(20);
+    EXPECT_EQ(invoked_ids(), (std::vector<uintptr_t>{0, 1, 2}));
+    EXPECT_EQ(invocations[1].trigger_time, 11);
+}
+
+namespace {
+
+deferred_token cancelled_token;
+
+uint32_t cancel_callback(uint32_t trigger_time, void *cb_arg) {
+    invocations.push_back({(uintptr_t)cb_arg, trigger_time});
+    cancel_deferred_exec_advanced(chain_table, DeferredExec::TABLE_SIZE, cancelled_token);
+    return 0;
+}
+
+} // namespace
+
+TEST_F(DeferredExec, callback_cancels_another_due_executor) {
+    chain_table = table;
+    defer_exec_advanced(table, TABLE_SIZE, 10, cancel_callback, (void *)0);
+    cancelled_token = defer(11, 1);
+    defer(11, 2);
+
+    advance_time(15);
+    deferred_exec_advanced_task(table, TABLE_SIZE, &state);
+    EXPECT_EQ(invoked_ids(), (std::vector<uintptr_t>{0, 2}));
+    EXPECT_EQ(deferred_exec_advanced_next_deadline(table, TABLE_SIZE), UINT32_MAX);
+    EXPECT_NE(defer(10, 3), INVALID_DEFERRED_TOKEN);
+}
+
+TEST_F(DeferredExec, basic_api_task_interval) {
+    EXPECT_EQ(deferred_exec_next_deadline(), UINT32_MAX);
+    EXPECT_EQ(deferred_exec_task_interval(), UINT16_MAX);
+
+    deferred_token token = defer_exec(50, record_callback, (void *)0);
+    EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(deferred_exec_next_deadline(), 50);
+    EXPECT_EQ(deferred_exec_task_interval(), 50);
+
+    EXPECT_TRUE(extend_deferred_exec(token, 20));
+    EXPECT_EQ(deferred_exec_task_interval(), 20);
+
+    EXPECT_TRUE(cancel_deferred_exec(token));
+    EXPECT_EQ(deferred_exec_task_interval(), UINT16_MAX);
+}
+
+namespace {
+
+uint32_t slow_callback(uint32_t trigger_time, void *cb_arg) {
+    uint32_t delay_ms = record_callback(trigger_time, cb_arg);
+    advance_time(TASK_SCHEDULER_MAX_MATRIX_GAP);
+    return delay_ms;
+}
+
+} // namespace
+
+TEST_F(DeferredExec, slow_executor_does_not_starve_later_ones) {
+    repeat_delay[0] = 1;
+    repeat_delay[1] = 1;
+    repeat_delay[2] = 1;
+    defer_exec_advanced(table, TABLE_SIZE, 1, slow_callback, (void *)0);
+    defer(1, 1);
+    defer(1, 2);
+
+    /* The slow executor is due on every run and makes each run yield. */
+    for (int i = 0; i < 10; i++) {
+        advance_time(1);
+        task_scheduler_task_start(TASK_SCHEDULER_DEFERRED_EXEC);
+        deferred_exec_advanced_task(table, TABLE_SIZE, &state);
+        task_scheduler_task_end(TASK_SCHEDULER_DEFERRED_EXEC);
+    }
+
+    size_t counts[3] = {0};
+    for (auto &invocation : invocations) {
+        counts[invocation.id]++;
+    }
+    EXPECT_GE(counts[0], 3);
+    EXPECT_GE(counts[1], 3);
+    EXPECT_GE(counts[2], 3);
+}
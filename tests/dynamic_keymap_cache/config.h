@@ -0,0 +1,13 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DYNAMIC_KEYMAP_LAYER_COUNT 3
+#define DYNAMIC_KEYMAP_CACHE
+#define DYNAMIC_KEYMAP_CACHE_LAYER_COUNT 2
+
+// The test platform EEPROM is too small for dynamic keymaps by default
+#define EEPROM_SIZE 1024
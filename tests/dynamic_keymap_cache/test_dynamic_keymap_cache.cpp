@@ -0,0 +1,79 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+}
+
+class DynamicKeymapCache : public TestFixture {
+   protected:
+    static const uint16_t KEYMAP_SIZE = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+
+    // Every keycode must match the big endian copy in EEPROM
+    void expect_matches_eeprom() {
+        uint8_t buffer[KEYMAP_SIZE];
+        dynamic_keymap_get_buffer(0, sizeof(buffer), buffer);
+        for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    uint16_t offset = ((layer * MATRIX_ROWS + row) * MATRIX_COLS + col) * 2;
+                    EXPECT_EQ(dynamic_keymap_get_keycode(layer, row, col), (buffer[offset] << 8) | buffer[offset + 1]) << "layer " << +layer << " row " << +row << " col " << +col;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(DynamicKeymapCache, ResetIsMirrored) {
+    dynamic_keymap_reset();
+    expect_matches_eeprom();
+}
+
+TEST_F(DynamicKeymapCache, SetKeycodeUpdatesCachedAndUncachedLayers) {
+    dynamic_keymap_set_keycode(0, 0, 1, KC_A);
+    dynamic_keymap_set_keycode(1, 1, 2, LT(2, KC_B));
+    dynamic_keymap_set_keycode(2, 2, 3, KC_C);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), KC_A);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 1, 2), LT(2, KC_B));
+    EXPECT_EQ(dynamic_keymap_get_keycode(2, 2, 3), KC_C);
+    expect_matches_eeprom();
+}
+
+TEST_F(DynamicKeymapCache, CachedLayersAreServedFromRam) {
+    dynamic_keymap_set_keycode(0, 0, 0, KC_A);
+    dynamic_keymap_set_keycode(2, 0, 0, KC_A);
+
+    // Change EEPROM behind the cache's back, only the uncached layer sees it
+    eeprom_update_byte((uint8_t *)dynamic_keymap_key_to_eeprom_address(0, 0, 0) + 1, KC_B);
+    eeprom_update_byte((uint8_t *)dynamic_keymap_key_to_eeprom_address(2, 0, 0) + 1, KC_B);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_A);
+    EXPECT_EQ(dynamic_keymap_get_keycode(2, 0, 0), KC_B);
+
+    dynamic_keymap_set_keycode(0, 0, 0, KC_A);
+}
+
+TEST_F(DynamicKeymapCache, UnalignedSetBufferUpdatesCache) {
+    dynamic_keymap_reset();
+
+    // Start on the low byte of one keycode and end on the high byte of another, across the cached and uncached layers
+    uint16_t offset = DYNAMIC_KEYMAP_CACHE_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2 - 5;
+    uint8_t  data[10];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = 0x11 * (i + 1);
+    }
+    dynamic_keymap_set_buffer(offset, sizeof(data), data);
+    expect_matches_eeprom();
+
+    // And a whole keymap upload
+    uint8_t buffer[KEYMAP_SIZE];
+    for (uint16_t i = 0; i < sizeof(buffer); i++) {
+        buffer[i] = i * 7;
+    }
+    dynamic_keymap_set_buffer(0, sizeof(buffer), buffer);
+    expect_matches_eeprom();
+}
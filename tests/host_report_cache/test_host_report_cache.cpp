@@ -0,0 +1,68 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "host.h"
+}
+
+using testing::_;
+
+class HostReportCache : public TestFixture {
+   public:
+    HostReportCache() {
+        host_reset_suppressed_report_count();
+    }
+};
+
+static report_keyboard_t make_keyboard_report(uint8_t key) {
+    report_keyboard_t report = {};
+    report.keys[0]           = key;
+    return report;
+}
+
+TEST_F(HostReportCache, unchanged_keyboard_report_is_passed_on) {
+    TestDriver driver;
+
+    /* The driver may have dropped the first copy on a busy endpoint, so
+     * host.c never decides that a keyboard report was delivered. */
+    EXPECT_REPORT(driver, (KC_A)).Times(2);
+    report_keyboard_t report = make_keyboard_report(KC_A);
+    host_keyboard_send(&report);
+    report = make_keyboard_report(KC_A);
+    host_keyboard_send(&report);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportCache, unchanged_mouse_report_is_passed_on) {
+    TestDriver     driver;
+    report_mouse_t report = {};
+
+    /* Like keyboard reports, mouse reports are always passed on. If the
+     * driver dropped a button release, the next one still releases it. */
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(2);
+    report.buttons = 1;
+    host_mouse_send(&report);
+    host_mouse_send(&report);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(2);
+    report.buttons = 0;
+    host_mouse_send(&report);
+    host_mouse_send(&report);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportCache, unchanged_consumer_usage_is_counted) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_extra_mock(_)).Times(2);
+    host_consumer_send(AUDIO_VOL_UP);
+    host_consumer_send(AUDIO_VOL_UP);
+    host_consumer_send(0);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(host_suppressed_report_count(HOST_REPORT_CONSUMER), 1);
+    EXPECT_EQ(host_suppressed_report_count(HOST_REPORT_SYSTEM), 0);
+}
@@ -0,0 +1,240 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <utility>
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::AtLeast;
+using testing::InSequence;
+
+/* The keymap puts a long list of right alt overrides in front of the ones
+ * under test, so the benchmark at the end shows what the search through the
+ * override list costs per key event. */
+class KeyOverride : public TestFixture {};
+
+TEST_F(KeyOverride, trigger_with_mods_is_replaced) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  shift(0, 0, 0, KC_LSFT);
+    KeymapKey  backspace(0, 1, 0, KC_BSPC);
+    set_keymap({shift, backspace});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    backspace.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    backspace.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, trigger_without_mods_is_sent) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  backspace(0, 1, 0, KC_BSPC);
+    set_keymap({backspace});
+
+    EXPECT_REPORT(driver, (KC_BSPC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(backspace);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, first_matching_override_wins) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  control(0, 0, 0, KC_LCTL);
+    KeymapKey  shift(0, 1, 0, KC_LSFT);
+    KeymapKey  key_h(0, 2, 0, KC_H);
+    set_keymap({control, shift, key_h});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    control.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_HOME));
+    key_h.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    key_h.release();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    control.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, later_override_for_same_trigger) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  control(0, 0, 0, KC_LCTL);
+    KeymapKey  key_h(0, 2, 0, KC_H);
+    set_keymap({control, key_h});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    control.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LEFT));
+    key_h.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_h.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    control.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, mods_pressed_after_trigger) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  control(0, 0, 0, KC_LCTL);
+    KeymapKey  key_h(0, 2, 0, KC_H);
+    set_keymap({control, key_h});
+
+    EXPECT_REPORT(driver, (KC_H));
+    key_h.press();
+    run_one_scan_loop();
+
+    // The replacement is held back so that it doesn't repeat straight away
+    EXPECT_EMPTY_REPORT(driver);
+    control.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LEFT));
+    idle_for(KEY_OVERRIDE_REPEAT_DELAY);
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_h.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    control.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, negative_mods_block_override) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  control(0, 0, 0, KC_LCTL);
+    KeymapKey  shift(0, 1, 0, KC_LSFT);
+    KeymapKey  tab(0, 3, 0, KC_TAB);
+    set_keymap({control, shift, tab});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    control.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT, KC_TAB));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    tap_key(tab);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    control.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, mods_only_override) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  alt(0, 0, 0, KC_LALT);
+    KeymapKey  gui(0, 1, 0, KC_LGUI);
+    set_keymap({alt, gui});
+
+    EXPECT_REPORT(driver, (KC_LALT));
+    alt.press();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    gui.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_F24));
+    idle_for(KEY_OVERRIDE_REPEAT_DELAY);
+
+    // Deactivating the override restores the mods before the release goes out
+    EXPECT_REPORT(driver, (KC_LALT, KC_LGUI));
+    EXPECT_REPORT(driver, (KC_LGUI));
+    alt.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    gui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Times only the scan loops that carry a key event, so the idle scans in
+ * between don't water down the cost of searching the override list. */
+TEST_F(KeyOverride, event_cost) {
+    TestDriver driver;
+    KeymapKey  control(0, 0, 0, KC_LCTL);
+    KeymapKey  shift(0, 1, 0, KC_LSFT);
+    KeymapKey  key_h(0, 2, 0, KC_H);
+    KeymapKey  backspace(0, 3, 0, KC_BSPC);
+    KeymapKey  key_e(0, 4, 0, KC_E);
+    set_keymap({control, shift, key_h, backspace, key_e});
+
+    const std::vector<std::pair<KeymapKey *, bool>> events = {{&key_e, true}, {&key_e, false}, {&shift, true}, {&key_e, true}, {&key_e, false}, {&backspace, true}, {&backspace, false}, {&control, true}, {&key_h, true}, {&key_h, false}, {&shift, false}, {&control, false}};
+
+    /* Every event changes the report. */
+    const int rounds = 200;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AtLeast(rounds * events.size()));
+
+    std::chrono::nanoseconds elapsed{0};
+    for (int round = 0; round < rounds; ++round) {
+        for (auto &event : events) {
+            if (event.second) {
+                event.first->press();
+            } else {
+                event.first->release();
+            }
+            const auto start = std::chrono::steady_clock::now();
+            run_one_scan_loop();
+            elapsed += std::chrono::steady_clock::now() - start;
+            idle_for(10);
+        }
+    }
+
+    printf("\nkey overrides  %6.1f ns per event\n\n", (double)elapsed.count() / (rounds * events.size()));
+
+    VERIFY_AND_CLEAR(driver);
+}
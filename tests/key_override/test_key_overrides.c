@@ -0,0 +1,34 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// Overrides on right alt, which the tests never hold, so that every key event has a long list to get through
+#define FILLER_KEYS(X)                                                                                                                                         \
+    X(KC_A) X(KC_B) X(KC_C) X(KC_D) X(KC_E) X(KC_F) X(KC_G) X(KC_I) X(KC_J) X(KC_K) X(KC_L) X(KC_M) X(KC_N) X(KC_O) X(KC_P) X(KC_Q) X(KC_R) X(KC_S) X(KC_T)   \
+    X(KC_U) X(KC_V) X(KC_W) X(KC_X) X(KC_Y) X(KC_Z) X(KC_1) X(KC_2) X(KC_3) X(KC_4) X(KC_5) X(KC_6) X(KC_7) X(KC_8) X(KC_9) X(KC_0) X(KC_F1) X(KC_F2) X(KC_F3) \
+    X(KC_F4) X(KC_F5) X(KC_F6) X(KC_F7) X(KC_F8) X(KC_F9) X(KC_F10) X(KC_F11) X(KC_F12) X(KC_F13) X(KC_F14) X(KC_F15) X(KC_F16) X(KC_F17) X(KC_F18)          \
+    X(KC_F19) X(KC_F20) X(KC_F21) X(KC_F22) X(KC_F23) X(KC_MINS) X(KC_EQL) X(KC_LBRC) X(KC_RBRC) X(KC_SCLN) X(KC_QUOT) X(KC_COMM) X(KC_DOT) X(KC_SLSH)
+
+#define FILLER_OVERRIDE(kc) const key_override_t filler_##kc##_override = ko_make_basic(MOD_BIT(KC_RALT), kc, KC_NO);
+#define FILLER_ENTRY(kc) &filler_##kc##_override,
+
+FILLER_KEYS(FILLER_OVERRIDE)
+
+const key_override_t delete_key_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t home_key_override   = ko_make_basic(MOD_MASK_CS, KC_H, KC_HOME);
+const key_override_t left_key_override   = ko_make_basic(MOD_MASK_CTRL, KC_H, KC_LEFT);
+const key_override_t tab_key_override    = ko_make_with_layers_and_negmods(MOD_MASK_CTRL, KC_TAB, KC_ESC, ~0, MOD_MASK_SHIFT);
+const key_override_t alt_gui_override    = ko_make_basic(MOD_BIT(KC_LALT) | MOD_BIT(KC_LGUI), KC_NO, KC_F24);
+
+// clang-format off
+const key_override_t **key_overrides = (const key_override_t *[]){
+    FILLER_KEYS(FILLER_ENTRY)
+    &delete_key_override,
+    &home_key_override,
+    &left_key_override,
+    &tab_key_override,
+    &alt_gui_override,
+    NULL
+};
+// clang-format on
@@ -0,0 +1,111 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "latency_fixture.hpp"
+#include "test_common.hpp"
+
+/* Replays scripted key traces through keyboard_task() with tap-hold, combos,
+ * auto shift and key overrides all enabled, and prints a per-trace table of
+ * scan loops and milliseconds until each change reaches the host. The
+ * expectations are upper bounds, so a feature that starts adding latency
+ * shows up as a failing test rather than as a different number in the log. */
+class Latency : public LatencyFixture {};
+
+TEST_F(Latency, plain_key) {
+    TestDriver driver;
+    KeymapKey  key(0, 0, 0, KC_F1);
+    set_keymap({key});
+
+    run_trace(driver, {"plain key", {{key, true, 0}, {key, false, 20}}, 10});
+    EXPECT_EQ(sample(0).scans, 1);
+    EXPECT_EQ(sample(0).ms, 0);
+    EXPECT_EQ(sample(1).scans, 1);
+    EXPECT_EQ(sample(1).ms, 0);
+}
+
+TEST_F(Latency, plain_key_fast_scan) {
+    TestDriver driver;
+    KeymapKey  key(0, 0, 0, KC_F1);
+    set_keymap({key});
+
+    run_trace(driver, {"plain key 4 scans/ms", {{key, true, 0}, {key, false, 20}}, 10}, 4);
+    EXPECT_EQ(sample(0).scans, 1);
+    EXPECT_EQ(sample(1).scans, 1);
+}
+
+TEST_F(Latency, mod_tap_tapped) {
+    TestDriver driver;
+    KeymapKey  key(0, 1, 0, LSFT_T(KC_P));
+    set_keymap({key});
+
+    run_trace(driver, {"mod-tap tap", {{key, true, 0}, {key, false, 50}}, 10});
+    EXPECT_LE(sample(0).ms, 50);
+    EXPECT_EQ(sample(1).ms, 0);
+}
+
+TEST_F(Latency, mod_tap_held) {
+    TestDriver driver;
+    KeymapKey  key(0, 1, 0, LSFT_T(KC_P));
+    set_keymap({key});
+
+    run_trace(driver, {"mod-tap hold", {{key, true, 0}, {key, false, TAPPING_TERM + 50}}, 10});
+    EXPECT_LE(sample(0).ms, TAPPING_TERM);
+    EXPECT_EQ(sample(1).ms, 0);
+}
+
+TEST_F(Latency, combo_chord) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 2, 0, KC_F13);
+    KeymapKey  key_b(0, 3, 0, KC_F14);
+    set_keymap({key_a, key_b});
+
+    run_trace(driver, {"combo chord", {{key_a, true, 0}, {key_b, true, 5}, {key_a, false, 30}, {key_b, false, 30}}, 10});
+    // A completed chord is held back until COMBO_TERM expires or a key is
+    // released, in case a longer overlapping combo is still being typed.
+    EXPECT_LE(sample(1).ms, COMBO_TERM + 1);
+    EXPECT_LE(sample(2).ms, 1);
+}
+
+TEST_F(Latency, combo_single_key) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 2, 0, KC_F13);
+    KeymapKey  key_b(0, 3, 0, KC_F14);
+    set_keymap({key_a, key_b});
+
+    run_trace(driver, {"combo key alone", {{key_a, true, 0}, {key_a, false, COMBO_TERM + 50}}, 10});
+    EXPECT_LE(sample(0).ms, COMBO_TERM + 1);
+    EXPECT_LE(sample(1).ms, 1);
+}
+
+TEST_F(Latency, auto_shift_tapped) {
+    TestDriver driver;
+    KeymapKey  key(0, 4, 0, KC_E);
+    set_keymap({key});
+
+    run_trace(driver, {"auto shift tap", {{key, true, 0}, {key, false, 50}}, 10});
+    EXPECT_LE(sample(0).ms, 50);
+    EXPECT_LE(sample(1).ms, 1);
+}
+
+TEST_F(Latency, auto_shift_held) {
+    TestDriver driver;
+    KeymapKey  key(0, 4, 0, KC_E);
+    set_keymap({key});
+
+    run_trace(driver, {"auto shift hold", {{key, true, 0}, {key, false, AUTO_SHIFT_TIMEOUT + 50}}, 10});
+    EXPECT_LE(sample(0).ms, AUTO_SHIFT_TIMEOUT);
+    EXPECT_LE(sample(1).ms, 1);
+}
+
+TEST_F(Latency, key_override) {
+    TestDriver driver;
+    KeymapKey  shift(0, 5, 0, KC_LSFT);
+    KeymapKey  backspace(0, 6, 0, KC_BSPC);
+    set_keymap({shift, backspace});
+
+    run_trace(driver, {"key override", {{shift, true, 0}, {backspace, true, 10}, {backspace, false, 30}, {shift, false, 40}}, 10});
+    EXPECT_EQ(sample(0).ms, 0);
+    EXPECT_LE(sample(1).ms, 1);
+    EXPECT_LE(sample(2).ms, 1);
+}
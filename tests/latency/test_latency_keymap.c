@@ -0,0 +1,23 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+enum combos { escape };
+
+uint16_t const escape_combo[] = {KC_F13, KC_F14, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [escape] = COMBO(escape_combo, KC_ESC)
+};
+// clang-format on
+
+const key_override_t delete_key_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+
+// clang-format off
+const key_override_t **key_overrides = (const key_override_t *[]){
+    &delete_key_override,
+    NULL
+};
+// clang-format on
@@ -0,0 +1,118 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+
+class LayerLookupCache : public TestFixture {};
+
+TEST_F(LayerLookupCache, transparent_keys_fall_through) {
+    TestDriver driver;
+    KeymapKey  base(0, 0, 0, KC_A);
+    KeymapKey  upper(3, 0, 0, KC_TRANSPARENT);
+    KeymapKey  other(3, 1, 0, KC_B);
+    set_keymap({base, upper, other});
+
+    layer_on(3);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+    EXPECT_EQ(layer_switch_get_layer(other.position), 3);
+
+    /* Cached lookups return the same result. */
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+    EXPECT_EQ(layer_switch_get_layer(other.position), 3);
+
+    layer_clear();
+}
+
+TEST_F(LayerLookupCache, follows_layer_state_changes) {
+    TestDriver driver;
+    KeymapKey  base(0, 0, 0, KC_A);
+    KeymapKey  middle(1, 0, 0, KC_B);
+    KeymapKey  upper(2, 0, 0, KC_C);
+    set_keymap({base, middle, upper});
+
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 1);
+
+    /* Turning on a layer below the resolved one keeps the entry. */
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 2);
+    layer_off(1);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 2);
+
+    /* Turning off the resolved layer drops it. */
+    layer_off(2);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+
+    /* Writing the state directly is noticed as well. */
+    layer_state = (layer_state_t)1 << 1;
+    EXPECT_EQ(layer_switch_get_layer(base.position), 1);
+
+    layer_clear();
+}
+
+TEST_F(LayerLookupCache, follows_default_layer_changes) {
+    TestDriver driver;
+    KeymapKey  base(0, 0, 0, KC_A);
+    KeymapKey  alternate(1, 0, 0, KC_B);
+    set_keymap({base, alternate});
+
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+
+    default_layer_set((layer_state_t)1 << 1);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 1);
+
+    default_layer_set((layer_state_t)1 << 0);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+}
+
+TEST_F(LayerLookupCache, keymap_changes_are_picked_up) {
+    TestDriver driver;
+    KeymapKey  base(0, 0, 0, KC_A);
+    set_keymap({base, KeymapKey(1, 0, 0, KC_TRANSPARENT)});
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(base.position), 0);
+
+    set_keymap({base, KeymapKey(1, 0, 0, KC_B)});
+    EXPECT_EQ(layer_switch_get_layer(base.position), 1);
+
+    layer_clear();
+}
+
+TEST_F(LayerLookupCache, key_press_uses_resolved_layer) {
+    TestDriver driver;
+    KeymapKey  layer_key(0, 0, 0, MO(1));
+    KeymapKey  base(0, 1, 0, KC_A);
+    KeymapKey  upper(1, 1, 0, KC_B);
+    set_keymap({layer_key, base, upper});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(base);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(base);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(base);
+    VERIFY_AND_CLEAR(driver);
+}
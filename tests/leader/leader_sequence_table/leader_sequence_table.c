@@ -0,0 +1,48 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+static void tap_1(void) {
+    tap_code(KC_1);
+}
+
+static void tap_2(void) {
+    tap_code(KC_2);
+}
+
+static void tap_3(void) {
+    tap_code(KC_3);
+}
+
+static void tap_4(void) {
+    tap_code(KC_4);
+}
+
+static void tap_5(void) {
+    tap_code(KC_5);
+}
+
+// Leader, q, a to leader, q, z, which do nothing
+#define FILLER_KEYS(X) X(KC_A) X(KC_B) X(KC_C) X(KC_D) X(KC_E) X(KC_F) X(KC_G) X(KC_H) X(KC_I) X(KC_J) X(KC_K) X(KC_L) X(KC_M) X(KC_N) X(KC_O) X(KC_P) X(KC_Q) X(KC_R) X(KC_S) X(KC_T) X(KC_U) X(KC_V) X(KC_W) X(KC_X) X(KC_Y) X(KC_Z)
+#define FILLER_SEQUENCE(kc) LEADER_SEQUENCE(NULL, KC_Q, kc),
+
+// clang-format off
+const leader_sequence_t leader_sequences[] = {
+    FILLER_KEYS(FILLER_SEQUENCE)
+    LEADER_SEQUENCE(tap_3, KC_A, KC_B, KC_C),
+    LEADER_SEQUENCE(tap_1, KC_A),
+    LEADER_SEQUENCE(tap_2, KC_A, KC_B),
+    LEADER_SEQUENCE(tap_4, KC_D, KC_E),
+    LEADER_SEQUENCE(tap_5, KC_D, KC_F, KC_G, KC_H, KC_I),
+};
+// clang-format on
+
+void leader_end_user(void) {
+    if (leader_sequence_one_key(KC_Z)) {
+        tap_code(KC_0);
+    } else if (leader_sequence_three_keys(KC_D, KC_E, KC_Z)) {
+        // Only reachable without LEADER_SEQUENCE_TABLE_EARLY_END
+        tap_code(KC_9);
+    }
+}
@@ -0,0 +1,57 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+class Leader : public TestFixture {};
+
+TEST_F(Leader, unambiguous_sequence_waits_for_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_d      = KeymapKey(0, 1, 0, KC_D);
+    auto key_e      = KeymapKey(0, 2, 0, KC_E);
+
+    set_keymap({key_leader, key_d, key_e});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_d);
+    tap_key(key_e);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_4));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(Leader, leader_end_user_can_extend_table_entry) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_d      = KeymapKey(0, 1, 0, KC_D);
+    auto key_e      = KeymapKey(0, 2, 0, KC_E);
+    auto key_z      = KeymapKey(0, 3, 0, KC_Z);
+
+    set_keymap({key_leader, key_d, key_e, key_z});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_d);
+    tap_key(key_e);
+    tap_key(key_z);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_9));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+}
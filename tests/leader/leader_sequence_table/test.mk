@@ -0,0 +1,6 @@
+# Copyright 2023 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+LEADER_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = leader_sequence_table.c
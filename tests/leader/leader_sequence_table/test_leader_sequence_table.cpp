@@ -0,0 +1,174 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+class Leader : public TestFixture {};
+
+TEST_F(Leader, triggers_ambiguous_sequence_on_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_leader, key_a});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(Leader, triggers_prefix_of_longer_sequence_on_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_b      = KeymapKey(0, 2, 0, KC_B);
+
+    set_keymap({key_leader, key_a, key_b});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+}
+
+TEST_F(Leader, triggers_unambiguous_sequence_immediately) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_d      = KeymapKey(0, 1, 0, KC_D);
+    auto key_e      = KeymapKey(0, 2, 0, KC_E);
+
+    set_keymap({key_leader, key_d, key_e});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_d);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_4));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_e);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_e);
+}
+
+TEST_F(Leader, triggers_longest_sequence_immediately) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_b      = KeymapKey(0, 2, 0, KC_B);
+    auto key_c      = KeymapKey(0, 3, 0, KC_C);
+
+    set_keymap({key_leader, key_a, key_b, key_c});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_c);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(Leader, triggers_five_key_sequence_immediately) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_d      = KeymapKey(0, 1, 0, KC_D);
+    auto key_f      = KeymapKey(0, 2, 0, KC_F);
+    auto key_g      = KeymapKey(0, 3, 0, KC_G);
+    auto key_h      = KeymapKey(0, 4, 0, KC_H);
+    auto key_i      = KeymapKey(0, 5, 0, KC_I);
+
+    set_keymap({key_leader, key_d, key_f, key_g, key_h, key_i});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_d);
+    tap_key(key_f);
+    tap_key(key_g);
+    tap_key(key_h);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_5));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_i);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(Leader, unknown_sequence_does_nothing) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_e      = KeymapKey(0, 1, 0, KC_E);
+    auto key_q      = KeymapKey(0, 2, 0, KC_Q);
+
+    set_keymap({key_leader, key_e, key_q});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_e);
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+
+    // A sequence without an action does nothing either
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_q);
+    tap_key(key_e);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(Leader, calls_leader_end_user) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_z      = KeymapKey(0, 1, 0, KC_Z);
+
+    set_keymap({key_leader, key_z});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_z);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_0));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+}
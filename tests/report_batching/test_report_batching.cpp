@@ -0,0 +1,164 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+using testing::InvokeWithoutArgs;
+
+extern "C" {
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (keycode == KC_F13 && record->event.pressed) {
+        tap_code(KC_X);
+        return false;
+    }
+    return true;
+}
+}
+
+class ReportBatching : public TestFixture {};
+
+TEST_F(ReportBatching, chord_is_one_report) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 0, 1, KC_LEFT_SHIFT);
+    set_keymap({key_a, key_b, key_c});
+
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_LEFT_SHIFT));
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportBatching, release_and_press_is_one_report) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    key_a.release();
+    key_b.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportBatching, tap_within_a_scan_keeps_its_release) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a     = KeymapKey(0, 0, 0, KC_A);
+    auto       macro_key = KeymapKey(0, 1, 0, KC_F13);
+    set_keymap({key_a, macro_key});
+
+    /* The tapped key is pressed and released within the same scan, so the
+     * batch is sent before the release instead of swallowing the tap. */
+    EXPECT_REPORT(driver, (KC_A, KC_X));
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    macro_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    macro_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportBatching, repeated_tap_within_a_scan_is_kept) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_x     = KeymapKey(0, 0, 0, KC_X);
+    auto       macro_key = KeymapKey(0, 1, 0, KC_F13);
+    set_keymap({key_x, macro_key});
+
+    EXPECT_REPORT(driver, (KC_X));
+    key_x.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Releasing X and tapping it again in one scan must not merge into "X
+     * still held". */
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    key_x.release();
+    macro_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    macro_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportBatching, tap_code_delay_is_spent_after_the_press) {
+    TestDriver driver;
+    InSequence s;
+    auto       macro_key = KeymapKey(0, 0, 0, KC_F13);
+    set_keymap({macro_key});
+
+    /* The press has to reach the host before TAP_CODE_DELAY is waited out,
+     * not together with the release at the end of the scan. */
+    uint32_t press_time = 0, release_time = 0;
+    EXPECT_REPORT(driver, (KC_X)).WillOnce(InvokeWithoutArgs([&] { press_time = timer_read32(); }));
+    EXPECT_EMPTY_REPORT(driver).WillOnce(InvokeWithoutArgs([&] { release_time = timer_read32(); }));
+    macro_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_GE(release_time - press_time, TAP_CODE_DELAY);
+
+    EXPECT_NO_REPORT(driver);
+    macro_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportBatching, keyboard_report_is_sent_before_consumer_report) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a   = KeymapKey(0, 0, 0, KC_A);
+    auto       key_vol = KeymapKey(0, 1, 0, KC_AUDIO_VOL_UP);
+    set_keymap({key_a, key_vol});
+
+    /* KC_A comes first in the scan, so it must not be overtaken by the
+     * consumer report of the key after it. */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_CALL(driver, send_extra_mock(_));
+    key_a.press();
+    key_vol.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_CALL(driver, send_extra_mock(_));
+    key_a.release();
+    key_vol.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,292 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "host.h"
+#include "report_queue.h"
+#include "send_string.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+#define KEYBOARD_ENDPOINT 1
+#define MOUSE_ENDPOINT 2
+#define EXTRA_ENDPOINT 3
+
+/* Fake endpoint that hands the reports to the test driver, it stays busy
+ * until the test completes the transfer. */
+static bool            endpoint_busy   = false;
+static host_driver_t * endpoint_driver = nullptr;
+static report_queue_t *polled_queue    = nullptr;
+
+static bool transmit(uint8_t endpoint, const void *report, uint8_t size) {
+    if (endpoint_busy) {
+        return false;
+    }
+    endpoint_busy = true;
+
+    host_driver_t *driver = endpoint_driver != nullptr ? endpoint_driver : host_get_driver();
+    switch (endpoint) {
+        case KEYBOARD_ENDPOINT: {
+            report_keyboard_t keyboard = {};
+            memcpy(&keyboard, report, size);
+            driver->send_keyboard(&keyboard);
+            break;
+        }
+        case MOUSE_ENDPOINT: {
+            report_mouse_t mouse = {};
+            memcpy(&mouse, report, size);
+            driver->send_mouse(&mouse);
+            break;
+        }
+        default: {
+            report_extra_t extra = {};
+            memcpy(&extra, report, size);
+            driver->send_extra(&extra);
+            break;
+        }
+    }
+    return true;
+}
+
+static void complete_transfer(report_queue_t *queue) {
+    endpoint_busy = false;
+    report_queue_transmitted(queue);
+}
+
+/* The host collects the report in transfer while the queue waits. */
+static bool host_polls(uint8_t endpoint) {
+    complete_transfer(polled_queue);
+    return true;
+}
+
+/* The host does not collect anything before the wait times out. */
+static bool host_stalls(uint8_t endpoint) {
+    return false;
+}
+
+static report_keyboard_t make_keyboard_report(uint8_t key) {
+    report_keyboard_t report = {};
+    report.keys[0]           = key;
+    return report;
+}
+
+static report_mouse_t make_mouse_report(uint8_t buttons, int8_t x, int8_t y) {
+    report_mouse_t report = {};
+    report.buttons        = buttons;
+    report.x              = x;
+    report.y              = y;
+    return report;
+}
+
+MATCHER_P3(MouseReport, buttons, x, y, "") {
+    return arg.buttons == buttons && arg.x == x && arg.y == y;
+}
+
+class ReportQueue : public TestFixture {
+   public:
+    ReportQueue() {
+        endpoint_busy   = false;
+        endpoint_driver = nullptr;
+        polled_queue    = nullptr;
+    }
+};
+
+TEST_F(ReportQueue, reports_are_sent_in_order_as_transfers_complete) {
+    TestDriver     driver;
+    report_queue_t queue;
+    report_queue_init(&queue, KEYBOARD_ENDPOINT, transmit, host_stalls);
+
+    /* An idle endpoint sends the report right away. */
+    EXPECT_REPORT(driver, (KC_A)).Times(1);
+    report_keyboard_t report = make_keyboard_report(KC_A);
+    EXPECT_TRUE(report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_OTHER));
+    VERIFY_AND_CLEAR(driver);
+
+    /* A tap while the endpoint is busy is queued, not waited for. */
+    EXPECT_NO_REPORT(driver);
+    report = make_keyboard_report(KC_NO);
+    report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_OTHER);
+    report = make_keyboard_report(KC_B);
+    report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_OTHER);
+    report = make_keyboard_report(KC_NO);
+    report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_OTHER);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(report_queue_depth(&queue), 4);
+
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    complete_transfer(&queue);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B)).Times(1);
+    complete_transfer(&queue);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    complete_transfer(&queue);
+    VERIFY_AND_CLEAR(driver);
+
+    complete_transfer(&queue);
+    EXPECT_EQ(report_queue_depth(&queue), 0);
+    EXPECT_EQ(report_queue_max_depth(&queue), 4);
+    EXPECT_EQ(report_queue_coalesced_count(&queue), 0);
+    EXPECT_EQ(report_queue_dropped_count(&queue), 0);
+}
+
+TEST_F(ReportQueue, full_queue_waits_for_the_host) {
+    TestDriver     driver;
+    report_queue_t queue;
+    report_queue_init(&queue, KEYBOARD_ENDPOINT, transmit, host_polls);
+    polled_queue = &queue;
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_E));
+
+    const uint8_t keys[] = {KC_A, KC_B, KC_C, KC_D, KC_E};
+    for (uint8_t i = 0; i < sizeof(keys); i++) {
+        report_keyboard_t report = {};
+        for (uint8_t j = 0; j <= i; j++) {
+            report.keys[j] = keys[j];
+        }
+        if (i == 4) {
+            /* KC_D was released again before its state left the queue. */
+            report.keys[3] = KC_E;
+            report.keys[4] = KC_NO;
+        }
+        EXPECT_TRUE(report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_OTHER));
+    }
+    EXPECT_EQ(report_queue_depth(&queue), REPORT_QUEUE_LENGTH);
+
+    for (uint8_t i = 0; i < REPORT_QUEUE_LENGTH; i++) {
+        complete_transfer(&queue);
+    }
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(report_queue_coalesced_count(&queue), 0);
+    EXPECT_EQ(report_queue_dropped_count(&queue), 0);
+}
+
+TEST_F(ReportQueue, mouse_motion_accumulates) {
+    TestDriver     driver;
+    report_queue_t queue;
+    report_queue_init(&queue, MOUSE_ENDPOINT, transmit, host_stalls);
+
+    EXPECT_CALL(driver, send_mouse_mock(MouseReport(0, 1, 1))).Times(1);
+    report_mouse_t report = make_mouse_report(0, 1, 1);
+    report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_MOUSE);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Motion queued behind the transfer in progress is summed up. */
+    report = make_mouse_report(0, 10, -3);
+    report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_MOUSE);
+    report = make_mouse_report(0, 5, -4);
+    report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_MOUSE);
+    /* A button change is never merged. */
+    report = make_mouse_report(1, 2, 0);
+    report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_MOUSE);
+    /* Neither is motion that would overflow the report. */
+    report = make_mouse_report(1, 127, 0);
+    report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_MOUSE);
+    EXPECT_EQ(report_queue_depth(&queue), 4);
+    EXPECT_EQ(report_queue_coalesced_count(&queue), 1);
+
+    {
+        InSequence s;
+        EXPECT_CALL(driver, send_mouse_mock(MouseReport(0, 15, -7)));
+        EXPECT_CALL(driver, send_mouse_mock(MouseReport(1, 2, 0)));
+        EXPECT_CALL(driver, send_mouse_mock(MouseReport(1, 127, 0)));
+    }
+    for (uint8_t i = 0; i < 4; i++) {
+        complete_transfer(&queue);
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportQueue, reports_are_dropped_and_counted_when_the_host_stalls) {
+    TestDriver     driver;
+    report_queue_t queue;
+    report_queue_init(&queue, EXTRA_ENDPOINT, transmit, host_stalls);
+
+    EXPECT_CALL(driver, send_extra_mock(_)).Times(REPORT_QUEUE_LENGTH);
+    report_extra_t report = {};
+    report.report_id      = REPORT_ID_CONSUMER;
+    report.usage          = AUDIO_VOL_UP;
+    for (uint8_t i = 0; i < REPORT_QUEUE_LENGTH + 2; i++) {
+        EXPECT_EQ(report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_OTHER), i < REPORT_QUEUE_LENGTH);
+    }
+    EXPECT_EQ(report_queue_depth(&queue), REPORT_QUEUE_LENGTH);
+    EXPECT_EQ(report_queue_dropped_count(&queue), 2);
+
+    for (uint8_t i = 0; i < REPORT_QUEUE_LENGTH; i++) {
+        complete_transfer(&queue);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    report_queue_reset_stats(&queue);
+    EXPECT_EQ(report_queue_dropped_count(&queue), 0);
+    EXPECT_EQ(report_queue_max_depth(&queue), 0);
+}
+
+TEST_F(ReportQueue, clear_forgets_queued_reports) {
+    TestDriver     driver;
+    report_queue_t queue;
+    report_queue_init(&queue, KEYBOARD_ENDPOINT, transmit, host_stalls);
+
+    EXPECT_REPORT(driver, (KC_A)).Times(1);
+    report_keyboard_t report = make_keyboard_report(KC_A);
+    report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_OTHER);
+    report = make_keyboard_report(KC_B);
+    report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_OTHER);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The endpoint was reset, the transfer in progress never completes. */
+    report_queue_clear(&queue);
+    endpoint_busy = false;
+    EXPECT_EQ(report_queue_depth(&queue), 0);
+
+    EXPECT_REPORT(driver, (KC_C)).Times(1);
+    report = make_keyboard_report(KC_C);
+    report_queue_submit(&queue, &report, sizeof(report), REPORT_QUEUE_KIND_OTHER);
+    VERIFY_AND_CLEAR(driver);
+}
+
+static report_queue_t keyboard_queue;
+
+static void queued_send_keyboard(report_keyboard_t *report) {
+    report_queue_submit(&keyboard_queue, report, sizeof(report_keyboard_t), REPORT_QUEUE_KIND_OTHER);
+}
+
+TEST_F(ReportQueue, send_string_burst_keeps_every_tap) {
+    TestDriver driver;
+    endpoint_driver = host_get_driver();
+    report_queue_init(&keyboard_queue, KEYBOARD_ENDPOINT, transmit, host_polls);
+    polled_queue = &keyboard_queue;
+
+    /* Route the keyboard reports through the queue, as usb_main.c does. */
+    host_driver_t queued_driver = *endpoint_driver;
+    queued_driver.send_keyboard = queued_send_keyboard;
+    host_set_driver(&queued_driver);
+
+    {
+        InSequence s;
+        for (const uint8_t key : {KC_H, KC_E, KC_L, KC_L, KC_O}) {
+            EXPECT_REPORT(driver, (key));
+            EXPECT_EMPTY_REPORT(driver);
+        }
+    }
+    send_string("hello");
+    while (report_queue_depth(&keyboard_queue) > 0) {
+        complete_transfer(&keyboard_queue);
+    }
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(report_queue_dropped_count(&keyboard_queue), 0);
+
+    host_set_driver(endpoint_driver);
+}
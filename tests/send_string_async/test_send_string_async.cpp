@@ -0,0 +1,204 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "eeprom.h"
+#include "send_string.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+namespace {
+
+int completed = 0;
+
+void count_completion(void *cb_arg) {
+    completed += (intptr_t)cb_arg;
+}
+
+} // namespace
+
+class SendStringAsync : public TestFixture {
+   public:
+    SendStringAsync() {
+        completed = 0;
+    }
+
+    ~SendStringAsync() {
+        send_string_async_cancel();
+    }
+};
+
+TEST_F(SendStringAsync, types_one_character_per_scan) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async("ab", 0, count_completion, (void *)1));
+    EXPECT_TRUE(send_string_async_is_busy());
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_EQ(completed, 1);
+    EXPECT_FALSE(send_string_async_is_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, matrix_is_scanned_while_typing) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_x = KeymapKey(0, 0, 0, KC_X);
+    set_keymap({key_x});
+
+    send_string_async("ab", 10, count_completion, (void *)1);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The key press is reported straight away instead of after the string. */
+    EXPECT_REPORT(driver, (KC_X));
+    key_x.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_x.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(7);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    idle_for(10);
+    EXPECT_EQ(completed, 1);
+}
+
+TEST_F(SendStringAsync, progmem_string_with_sequences) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async_P(PSTR("A" SS_DELAY(20) SS_TAP(X_B) SS_DOWN(X_LCTL) "c" SS_UP(X_LCTL)), 0, count_completion, (void *)1));
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The delay is waited out without holding up the scan loop. */
+    EXPECT_NO_REPORT(driver);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_C));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(5);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(completed, 1);
+}
+
+TEST_F(SendStringAsync, eeprom_string) {
+    TestDriver driver;
+    InSequence s;
+
+    const char macro[] = "hi";
+    eeprom_update_block(macro, (void *)64, sizeof(macro));
+    EXPECT_TRUE(send_string_async_eeprom((const void *)64, 0, count_completion, (void *)1));
+
+    EXPECT_REPORT(driver, (KC_H));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_I));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(3);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(completed, 1);
+}
+
+TEST_F(SendStringAsync, strings_are_typed_in_order) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async("a", 0, count_completion, (void *)1));
+    EXPECT_TRUE(send_string_async_P(PSTR("b"), 0, count_completion, (void *)10));
+    EXPECT_TRUE(send_string_async("c", 0, count_completion, (void *)100));
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(6);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(completed, 111);
+}
+
+TEST_F(SendStringAsync, full_buffer_is_rejected) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    /* 16 byte buffer: the terminator needs a byte too. */
+    EXPECT_TRUE(send_string_async("abcdefghij", 0, NULL, NULL));
+    EXPECT_FALSE(send_string_async("klmnop", 0, NULL, NULL));
+    EXPECT_TRUE(send_string_async("klmn", 0, NULL, NULL));
+
+    /* Space is released once a string has been typed out. */
+    idle_for(12);
+    EXPECT_TRUE(send_string_async("pqrstuvwxy", 0, NULL, NULL));
+    idle_for(20);
+    EXPECT_FALSE(send_string_async_is_busy());
+}
+
+TEST_F(SendStringAsync, cancel_drops_queued_strings) {
+    TestDriver driver;
+    InSequence s;
+
+    send_string_async("ab", 0, count_completion, (void *)1);
+    send_string_async_P(PSTR("cd"), 0, count_completion, (void *)1);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    send_string_async_cancel();
+    EXPECT_FALSE(send_string_async_is_busy());
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(completed, 0);
+
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_async("e", 0, NULL, NULL);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+}
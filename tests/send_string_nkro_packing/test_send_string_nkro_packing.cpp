@@ -0,0 +1,88 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "keycode_config.h"
+#include "send_string.h"
+}
+
+using testing::InSequence;
+
+class SendStringNkroPacking : public TestFixture {
+   public:
+    SendStringNkroPacking() {
+        keymap_config.nkro = true;
+    }
+    ~SendStringNkroPacking() {
+        keymap_config.nkro = false;
+    }
+};
+
+TEST_F(SendStringNkroPacking, ascending_run_is_one_report) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("abc");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringNkroPacking, repeated_or_lower_keycode_starts_new_run) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_H));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_E, KC_L));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_L, KC_O));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("hello");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringNkroPacking, mods_change_starts_new_run) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    /* The modifiers go out in their own report ahead of the keys. */
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B, KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("aBCd");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringNkroPacking, run_is_split_at_packing_keys) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_E, KC_F));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("abcdef");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringNkroPacking, no_packing_without_nkro) {
+    TestDriver driver;
+    InSequence s;
+
+    keymap_config.nkro = false;
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("ab");
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,123 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "task_profiler.h"
+
+/* Mocked timestamp source: every read advances the clock by `timestamp_step` ticks. */
+static uint32_t mock_timestamp = 0;
+static uint32_t timestamp_step = 5;
+
+uint32_t task_profiler_timestamp(void) {
+    mock_timestamp += timestamp_step;
+    return mock_timestamp;
+}
+}
+
+class TaskProfiler : public TestFixture {
+   public:
+    TaskProfiler() {
+        task_profiler_reset();
+        timestamp_step = 5;
+    }
+};
+
+TEST_F(TaskProfiler, keyboard_task_stages_are_profiled) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    idle_for(10);
+
+    const task_profiler_stats_t *matrix = task_profiler_get_stats(TASK_PROFILER_MATRIX_TASK);
+    EXPECT_EQ(matrix->count, 10);
+    EXPECT_EQ(matrix->min, 5);
+    EXPECT_EQ(matrix->max, 5);
+    EXPECT_EQ(matrix->total, 50);
+
+    EXPECT_EQ(task_profiler_get_stats(TASK_PROFILER_QUANTUM_TASK)->count, 10);
+    EXPECT_EQ(task_profiler_get_stats(TASK_PROFILER_LED_TASK)->count, 10);
+
+    /* The whole loop contains every nested stage, so it must take longer than any of them. */
+    const task_profiler_stats_t *loop = task_profiler_get_stats(TASK_PROFILER_KEYBOARD_TASK);
+    EXPECT_EQ(loop->count, 10);
+    EXPECT_GT(loop->min, matrix->max);
+
+    /* Stages that are not compiled in never record anything. */
+    EXPECT_EQ(task_profiler_get_stats(TASK_PROFILER_RGB_MATRIX_TASK)->count, 0);
+}
+
+TEST_F(TaskProfiler, histogram_percentiles) {
+    for (uint32_t duration = 1; duration <= 100; duration++) {
+        task_profiler_record(TASK_PROFILER_USER, duration);
+    }
+
+    const task_profiler_stats_t *user = task_profiler_get_stats(TASK_PROFILER_USER);
+    EXPECT_EQ(user->count, 100);
+    EXPECT_EQ(user->min, 1);
+    EXPECT_EQ(user->max, 100);
+
+    /* Buckets hold durations up to the next power of two. */
+    EXPECT_EQ(task_profiler_percentile(TASK_PROFILER_USER, 50), 63);
+    EXPECT_EQ(task_profiler_percentile(TASK_PROFILER_USER, 60), 63);
+    EXPECT_EQ(task_profiler_percentile(TASK_PROFILER_USER, 90), 100);
+    EXPECT_EQ(task_profiler_percentile(TASK_PROFILER_USER, 100), 100);
+    EXPECT_EQ(task_profiler_percentile(TASK_PROFILER_MIDI_TASK, 50), 0);
+}
+
+TEST_F(TaskProfiler, long_runs_stay_consistent) {
+    /* The total of many long durations no longer fits 32 bits. */
+    for (uint32_t i = 0; i < UINT16_MAX; i++) {
+        task_profiler_record(TASK_PROFILER_USER, 100000);
+    }
+    task_profiler_record(TASK_PROFILER_USER, 1);
+    task_profiler_record(TASK_PROFILER_USER, 200000);
+
+    const task_profiler_stats_t *user = task_profiler_get_stats(TASK_PROFILER_USER);
+    EXPECT_EQ(user->count, UINT16_MAX);
+    EXPECT_EQ(user->total, (uint64_t)UINT16_MAX * 100000);
+    EXPECT_EQ(user->min, 1);
+    EXPECT_EQ(user->max, 200000);
+
+    /* The histogram stopped together with the count. */
+    uint32_t samples = 0;
+    for (uint8_t i = 0; i < TASK_PROFILER_HISTOGRAM_BUCKETS; i++) {
+        samples += user->histogram[i];
+    }
+    EXPECT_EQ(samples, user->count);
+}
+
+TEST_F(TaskProfiler, recent_samples_ring) {
+    for (uint32_t duration = 1; duration <= 12; duration++) {
+        task_profiler_record(TASK_PROFILER_USER, duration);
+    }
+
+    task_profiler_sample_t samples[16];
+    ASSERT_EQ(task_profiler_recent_samples(samples, 16), TASK_PROFILER_RING_SIZE);
+    EXPECT_EQ(samples[0].duration, 12);
+    EXPECT_EQ(samples[0].task, TASK_PROFILER_USER);
+    EXPECT_EQ(samples[TASK_PROFILER_RING_SIZE - 1].duration, 12 - TASK_PROFILER_RING_SIZE + 1);
+
+    ASSERT_EQ(task_profiler_recent_samples(samples, 2), 2);
+    EXPECT_EQ(samples[1].duration, 11);
+}
+
+TEST_F(TaskProfiler, serialize) {
+    task_profiler_record(TASK_PROFILER_USER, 3);
+    task_profiler_record(TASK_PROFILER_USER, 300);
+
+    uint8_t data[32] = {0};
+    ASSERT_EQ(task_profiler_serialize(TASK_PROFILER_USER, data, sizeof(data)), 31);
+    EXPECT_EQ(data[0], TASK_PROFILER_USER);
+    EXPECT_EQ(data[1], 2);          // count
+    EXPECT_EQ(data[5], 3);          // min
+    EXPECT_EQ(data[9], 300 & 0xFF); // max
+    EXPECT_EQ(data[10], 300 >> 8);
+    EXPECT_EQ(data[25 + 2 * 2], 1); // one sample in bucket 2 (2..3)
+
+    /* Short buffers are truncated rather than overrun. */
+    EXPECT_EQ(task_profiler_serialize(TASK_PROFILER_USER, data, 3), 3);
+}
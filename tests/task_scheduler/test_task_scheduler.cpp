@@ -0,0 +1,189 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "task_profiler.h"
+#include "task_scheduler.h"
+
+void advance_time(uint32_t ms);
+
+/* Count every profiled call instead of measuring time. */
+uint32_t task_profiler_timestamp(void) {
+    return 0;
+}
+}
+
+using testing::_;
+
+class TaskScheduler : public TestFixture {
+   public:
+    TaskScheduler() {
+        task_profiler_reset();
+    }
+
+    uint32_t runs(task_profiler_id_t task) {
+        return task_profiler_get_stats(task)->count;
+    }
+};
+
+TEST_F(TaskScheduler, tasks_run_once_per_deadline) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    idle_for(1);
+    task_profiler_reset();
+
+    /* Several scans within the same millisecond only scan the matrix. */
+    for (int i = 0; i < 5; i++) {
+        keyboard_task();
+    }
+    EXPECT_EQ(runs(TASK_PROFILER_MATRIX_TASK), 5);
+    EXPECT_EQ(runs(TASK_PROFILER_QUANTUM_TASK), 1);
+    EXPECT_EQ(runs(TASK_PROFILER_LED_TASK), 1);
+    EXPECT_EQ(task_scheduler_next_deadline(), 1);
+
+    advance_time(1);
+    EXPECT_EQ(task_scheduler_next_deadline(), 0);
+    keyboard_task();
+    EXPECT_EQ(runs(TASK_PROFILER_MATRIX_TASK), 6);
+    EXPECT_EQ(runs(TASK_PROFILER_QUANTUM_TASK), 2);
+}
+
+TEST_F(TaskScheduler, matrix_change_wakes_quantum_task) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    idle_for(1);
+    keyboard_task();
+    task_profiler_reset();
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    keyboard_task();
+    EXPECT_EQ(runs(TASK_PROFILER_QUANTUM_TASK), 1);
+    EXPECT_EQ(runs(TASK_PROFILER_LED_TASK), 0);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskScheduler, woken_task_is_due_once) {
+    idle_for(1);
+    keyboard_task();
+    EXPECT_FALSE(task_scheduler_is_due(TASK_SCHEDULER_LED));
+
+    task_scheduler_wake(TASK_SCHEDULER_LED);
+    EXPECT_EQ(task_scheduler_next_deadline(), 0);
+    EXPECT_TRUE(task_scheduler_is_due(TASK_SCHEDULER_LED));
+    EXPECT_FALSE(task_scheduler_is_due(TASK_SCHEDULER_LED));
+}
+
+TEST_F(TaskScheduler, tap_hold_keeps_working) {
+    TestDriver driver;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    set_keymap({mod_tap_key});
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    idle_for(1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskScheduler, slow_task_is_interleaved_with_matrix_scans) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    idle_for(1);
+    keyboard_task();
+    task_profiler_reset();
+    task_scheduler_reset_overruns();
+
+    /* The key goes down while a task is busy for longer than the allowed gap,
+     * it is reported as soon as that task returns instead of on the next loop. */
+    key.press();
+    EXPECT_REPORT(driver, (KC_A));
+    task_scheduler_wake(TASK_SCHEDULER_DEFERRED_EXEC);
+    TASK_SCHEDULE(TASK_SCHEDULER_DEFERRED_EXEC, 1, advance_time(TASK_SCHEDULER_MAX_MATRIX_GAP + 1));
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(runs(TASK_PROFILER_MATRIX_TASK), 1);
+    EXPECT_EQ(task_scheduler_overruns(TASK_SCHEDULER_DEFERRED_EXEC), 1);
+
+    /* Reaching the gap exactly rescans the matrix without counting an overrun. */
+    task_scheduler_wake(TASK_SCHEDULER_DEFERRED_EXEC);
+    TASK_SCHEDULE(TASK_SCHEDULER_DEFERRED_EXEC, 1, advance_time(TASK_SCHEDULER_MAX_MATRIX_GAP));
+    EXPECT_EQ(runs(TASK_PROFILER_MATRIX_TASK), 2);
+    EXPECT_EQ(task_scheduler_overruns(TASK_SCHEDULER_DEFERRED_EXEC), 1);
+
+    /* A fast task leaves the matrix to the next loop. */
+    task_scheduler_wake(TASK_SCHEDULER_DEFERRED_EXEC);
+    TASK_SCHEDULE(TASK_SCHEDULER_DEFERRED_EXEC, 0, {});
+    EXPECT_EQ(runs(TASK_PROFILER_MATRIX_TASK), 2);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskScheduler, long_task_yields_within_budget) {
+    idle_for(1);
+    keyboard_task();
+    task_scheduler_reset_overruns();
+
+    EXPECT_FALSE(task_scheduler_should_yield());
+
+    uint32_t units = 0;
+    task_scheduler_wake(TASK_SCHEDULER_DEFERRED_EXEC);
+    TASK_SCHEDULE(TASK_SCHEDULER_DEFERRED_EXEC, 0, {
+        while (!task_scheduler_should_yield()) {
+            advance_time(1);
+            ++units;
+        }
+    });
+    EXPECT_EQ(units, TASK_SCHEDULER_TASK_BUDGET);
+    EXPECT_EQ(task_scheduler_overruns(TASK_SCHEDULER_DEFERRED_EXEC), 0);
+    EXPECT_FALSE(task_scheduler_should_yield());
+}
+
+TEST_F(TaskScheduler, matrix_change_between_tasks_is_reported) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    idle_for(1);
+    task_scheduler_begin();
+    EXPECT_FALSE(task_scheduler_matrix_changed());
+
+    /* The press is found by the scan that follows the long task. */
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    task_scheduler_wake(TASK_SCHEDULER_DEFERRED_EXEC);
+    TASK_SCHEDULE(TASK_SCHEDULER_DEFERRED_EXEC, 0, advance_time(TASK_SCHEDULER_MAX_MATRIX_GAP));
+    EXPECT_TRUE(task_scheduler_matrix_changed());
+
+    task_scheduler_begin();
+    EXPECT_FALSE(task_scheduler_matrix_changed());
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
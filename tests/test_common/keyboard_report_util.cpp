@@ -15,6 +15,8 @@
  */
 
 #include "keyboard_report_util.hpp"
+#include "host.h"
+#include "keycode_config.h"
 #include <cstdint>
 #include <vector>
 #include <algorithm>
@@ -25,27 +27,52 @@ extern std::map<uint16_t, std::string> KEYCODE_ID_TABLE;
 
 namespace {
 
+bool is_nkro_report() {
+#if defined(NKRO_ENABLE)
+    return keyboard_protocol && keymap_config.nkro;
+#else
+    return false;
+#endif
+}
+
+uint8_t report_mods(const report_keyboard_t& report) {
+#if defined(NKRO_ENABLE)
+    if (is_nkro_report()) {
+        return report.nkro.mods;
+    }
+#endif
+    return report.mods;
+}
+
 std::vector<uint8_t> get_keys(const report_keyboard_t& report) {
     std::vector<uint8_t> result;
-#if defined(NKRO_ENABLE)
-#    error NKRO support not implemented yet
-#elif defined(RING_BUFFERED_6KRO_REPORT_ENABLE)
+#if defined(RING_BUFFERED_6KRO_REPORT_ENABLE)
 #    error 6KRO support not implemented yet
-#else
+#endif
+#if defined(NKRO_ENABLE)
+    if (is_nkro_report()) {
+        for (size_t i = 0; i < KEYBOARD_REPORT_BITS * 8; i++) {
+            if (report.nkro.bits[i / 8] & (1 << (i % 8))) {
+                result.emplace_back(i);
+            }
+        }
+        return result;
+    }
+#endif
     for (size_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
         if (report.keys[i]) {
             result.emplace_back(report.keys[i]);
         }
     }
-#endif
     std::sort(result.begin(), result.end());
     return result;
 }
 
 std::vector<uint8_t> get_mods(const report_keyboard_t& report) {
     std::vector<uint8_t> result;
+    uint8_t              mods = report_mods(report);
     for (size_t i = 0; i < 8; i++) {
-        if (report.mods & (1 << i)) {
+        if (mods & (1 << i)) {
             uint8_t code = KC_LEFT_CTRL + i;
             result.emplace_back(code);
         }
@@ -59,7 +86,7 @@ std::vector<uint8_t> get_mods(const report_keyboard_t& report) {
 bool operator==(const report_keyboard_t& lhs, const report_keyboard_t& rhs) {
     auto lhskeys = get_keys(lhs);
     auto rhskeys = get_keys(rhs);
-    return lhs.mods == rhs.mods && lhskeys == rhskeys;
+    return report_mods(lhs) == report_mods(rhs) && lhskeys == rhskeys;
 }
 
 std::ostream& operator<<(std::ostream& os, const report_keyboard_t& report) {
@@ -95,14 +122,22 @@ std::ostream& operator<<(std::ostream& os, const report_keyboard_t& report) {
 }
 
 KeyboardReportMatcher::KeyboardReportMatcher(const std::vector<uint8_t>& keys) {
-    memset(m_report.raw, 0, sizeof(m_report.raw));
+    memset(&m_report, 0, sizeof(m_report));
+    uint8_t mods = 0;
     for (auto k : keys) {
         if (IS_MODIFIER_KEYCODE(k)) {
-            m_report.mods |= MOD_BIT(k);
+            mods |= MOD_BIT(k);
         } else {
             add_key_to_report(&m_report, k);
         }
     }
+#if defined(NKRO_ENABLE)
+    if (is_nkro_report()) {
+        m_report.nkro.mods = mods;
+        return;
+    }
+#endif
+    m_report.mods = mods;
 }
 
 bool KeyboardReportMatcher::MatchAndExplain(report_keyboard_t& report, MatchResultListener* listener) const {
@@ -0,0 +1,113 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "latency_fixture.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "gmock/gmock.h"
+#include "timer.h"
+
+extern "C" {
+#include "keyboard.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+std::vector<LatencyResult> LatencyFixture::results;
+
+const LatencyResult& LatencyFixture::run_trace(TestDriver& driver, const LatencyTrace& trace, unsigned scans_per_ms) {
+    struct Report {
+        uint32_t scan;
+        uint32_t time;
+    };
+    struct Pending {
+        std::string event;
+        uint32_t    scan;
+        uint32_t    time;
+    };
+
+    std::vector<Report>  reports;
+    std::vector<Pending> events;
+    LatencyResult        result = {trace.name, {}, 0, 0, 0, 0};
+    uint32_t             scan   = 0;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AnyNumber()).WillRepeatedly([&](report_keyboard_t&) { reports.push_back({scan, timer_read32()}); });
+
+    uint32_t end = trace.tail_ms;
+    for (auto& step : trace.steps) {
+        end = std::max(end, step.at_ms + trace.tail_ms);
+    }
+
+    // Several features treat a timer value of 0 as "not running", so never
+    // start a trace on the very first millisecond of the mocked clock.
+    if (timer_read32() == 0) {
+        advance_time(1);
+    }
+
+    for (uint32_t ms = 0; ms <= end; ms++) {
+        for (auto step : trace.steps) {
+            if (step.at_ms != ms) {
+                continue;
+            }
+            step.pressed ? step.key.press() : step.key.release();
+            events.push_back({step.key.name + (step.pressed ? " down" : " up"), scan, timer_read32()});
+        }
+
+        for (unsigned i = 0; i < scans_per_ms; i++, scan++) {
+            auto before = std::chrono::steady_clock::now();
+            keyboard_task();
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - before).count();
+
+            result.total_ns += elapsed;
+            result.max_ns = std::max<uint64_t>(result.max_ns, elapsed);
+        }
+        advance_time(1);
+    }
+
+    for (auto& event : events) {
+        auto report = std::find_if(reports.begin(), reports.end(), [&](const Report& r) { return r.scan >= event.scan; });
+        if (report == reports.end()) {
+            result.samples.push_back({event.event, false, 0, 0});
+        } else {
+            result.samples.push_back({event.event, true, report->scan - event.scan + 1, report->time - event.time});
+        }
+    }
+
+    result.reports = reports.size();
+    result.scans   = scan;
+    VERIFY_AND_CLEAR(driver);
+
+    results.push_back(result);
+    return results.back();
+}
+
+const LatencySample& LatencyFixture::sample(size_t index) const {
+    return results.back().samples.at(index);
+}
+
+void LatencyFixture::TearDownTestCase() {
+    std::cout << std::endl;
+    std::cout << std::left << std::setw(24) << "trace" << std::setw(28) << "event" << std::right << std::setw(8) << "scans" << std::setw(8) << "ms" << std::setw(10) << "reports" << std::setw(12) << "avg ns" << std::setw(12) << "max ns" << std::endl;
+    for (auto& result : results) {
+        bool first = true;
+        for (auto& sample : result.samples) {
+            std::cout << std::left << std::setw(24) << (first ? result.trace : "") << std::setw(28) << sample.event << std::right;
+            if (sample.reported) {
+                std::cout << std::setw(8) << sample.scans << std::setw(8) << sample.ms;
+            } else {
+                std::cout << std::setw(8) << "-" << std::setw(8) << "-";
+            }
+            if (first) {
+                std::cout << std::setw(10) << result.reports << std::setw(12) << (result.scans ? result.total_ns / result.scans : 0) << std::setw(12) << result.max_ns;
+            }
+            std::cout << std::endl;
+            first = false;
+        }
+    }
+    std::cout << std::endl;
+    results.clear();
+}
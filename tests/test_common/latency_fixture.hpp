@@ -0,0 +1,72 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+/**
+ * @brief A single matrix change within a latency trace.
+ */
+struct LatencyStep {
+    KeymapKey key;
+    bool      pressed;
+    /* Milliseconds since the start of the trace at which the change happens. */
+    uint32_t at_ms;
+};
+
+/**
+ * @brief A scripted sequence of matrix changes that is replayed through keyboard_task().
+ */
+struct LatencyTrace {
+    std::string              name;
+    std::vector<LatencyStep> steps;
+    /* Milliseconds to keep scanning after the last step, e.g. to let timeouts expire. */
+    uint32_t tail_ms = 0;
+};
+
+/**
+ * @brief Time from a matrix change until the next keyboard report reached the host driver.
+ */
+struct LatencySample {
+    std::string event;
+    bool        reported;
+    uint32_t    scans;
+    uint32_t    ms;
+};
+
+struct LatencyResult {
+    std::string                trace;
+    std::vector<LatencySample> samples;
+    uint32_t                   reports;
+    uint32_t                   scans;
+    /* Host CPU time spent inside keyboard_task(), in nanoseconds. */
+    uint64_t total_ns;
+    uint64_t max_ns;
+};
+
+/**
+ * @brief Test fixture that replays latency traces and collects one table per test suite.
+ *
+ * The mocked clock in platforms/test/timer.c only advances between scan loops,
+ * so `scans_per_ms` models the matrix scan rate of the target.
+ */
+class LatencyFixture : public TestFixture {
+   public:
+    static void TearDownTestCase();
+
+    const LatencyResult& run_trace(TestDriver& driver, const LatencyTrace& trace, unsigned scans_per_ms = 1);
+
+    /**
+     * @brief Returns the latency sample for the `index`th step of the last trace.
+     */
+    const LatencySample& sample(size_t index) const;
+
+   private:
+    static std::vector<LatencyResult> results;
+};
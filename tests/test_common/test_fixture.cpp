@@ -99,6 +99,7 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+    layer_lookup_cache_clear();
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -126,6 +127,7 @@ void TestFixture::tap_combo(const std::vector<KeymapKey>& chord_keys, unsigned d
 
 void TestFixture::set_keymap(std::initializer_list<KeymapKey> keys) {
     this->keymap.clear();
+    layer_lookup_cache_clear();
     for (auto& key : keys) {
         add_key(key);
     }
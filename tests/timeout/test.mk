@@ -0,0 +1,2 @@
+# Copyright 2023 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
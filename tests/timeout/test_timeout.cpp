@@ -0,0 +1,124 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "timeout.h"
+
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+std::vector<int> fired;
+
+void key_override_fired(void) {
+    fired.push_back(TIMEOUT_KEY_OVERRIDE);
+}
+
+void combo_fired(void) {
+    fired.push_back(TIMEOUT_COMBO);
+}
+
+void leader_fired(void) {
+    fired.push_back(TIMEOUT_LEADER);
+}
+
+void caps_word_rearms(void) {
+    fired.push_back(TIMEOUT_CAPS_WORD);
+    timeout_start(TIMEOUT_CAPS_WORD, 0, caps_word_rearms);
+}
+
+} // namespace
+
+class Timeout : public TestFixture {
+   public:
+    Timeout() {
+        fired.clear();
+        timeout_reset_lateness();
+    }
+
+    ~Timeout() {
+        for (int id = 0; id < TIMEOUT_COUNT; id++) {
+            timeout_cancel((timeout_id_t)id);
+        }
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            timeout_task();
+        }
+    }
+};
+
+TEST_F(Timeout, fires_once_at_deadline) {
+    timeout_start(TIMEOUT_LEADER, 10, leader_fired);
+    EXPECT_TRUE(timeout_is_pending(TIMEOUT_LEADER));
+
+    run_for(9);
+    EXPECT_TRUE(fired.empty());
+    run_for(1);
+    EXPECT_EQ(fired, (std::vector<int>{TIMEOUT_LEADER}));
+    EXPECT_FALSE(timeout_is_pending(TIMEOUT_LEADER));
+
+    run_for(20);
+    EXPECT_EQ(fired.size(), 1);
+}
+
+TEST_F(Timeout, restart_moves_deadline_and_cancel_disarms) {
+    timeout_start(TIMEOUT_LEADER, 10, leader_fired);
+    timeout_start(TIMEOUT_COMBO, 10, combo_fired);
+    run_for(5);
+    timeout_start(TIMEOUT_LEADER, 10, leader_fired);
+    timeout_cancel(TIMEOUT_COMBO);
+
+    run_for(9);
+    EXPECT_TRUE(fired.empty());
+    run_for(1);
+    EXPECT_EQ(fired, (std::vector<int>{TIMEOUT_LEADER}));
+}
+
+TEST_F(Timeout, expired_timeouts_run_in_deadline_then_declaration_order) {
+    timeout_start(TIMEOUT_LEADER, 3, leader_fired);
+    timeout_start(TIMEOUT_COMBO, 5, combo_fired);
+    timeout_start(TIMEOUT_KEY_OVERRIDE, 5, key_override_fired);
+
+    /* All three have expired by the time the task runs. */
+    advance_time(10);
+    timeout_task();
+    EXPECT_EQ(fired, (std::vector<int>{TIMEOUT_LEADER, TIMEOUT_KEY_OVERRIDE, TIMEOUT_COMBO}));
+    EXPECT_EQ(timeout_max_lateness(TIMEOUT_LEADER), 7);
+    EXPECT_EQ(timeout_max_lateness(TIMEOUT_COMBO), 5);
+}
+
+TEST_F(Timeout, rearmed_timeout_runs_once_per_task) {
+    timeout_start(TIMEOUT_CAPS_WORD, 1, caps_word_rearms);
+
+    run_for(1);
+    EXPECT_EQ(fired.size(), 1);
+    timeout_task();
+    EXPECT_EQ(fired.size(), 2);
+    run_for(3);
+    EXPECT_EQ(fired.size(), 5);
+}
+
+TEST_F(Timeout, next_deadline) {
+    EXPECT_EQ(timeout_next_deadline(), UINT32_MAX);
+
+    timeout_start(TIMEOUT_COMBO, 20, combo_fired);
+    timeout_start(TIMEOUT_LEADER, 8, leader_fired);
+    EXPECT_EQ(timeout_next_deadline(), 8);
+
+    /* Cancelling the earliest timeout moves the deadline to the next one. */
+    timeout_cancel(TIMEOUT_LEADER);
+    EXPECT_EQ(timeout_next_deadline(), 20);
+
+    advance_time(25);
+    EXPECT_EQ(timeout_next_deadline(), 0);
+    timeout_task();
+    EXPECT_EQ(timeout_next_deadline(), UINT32_MAX);
+}
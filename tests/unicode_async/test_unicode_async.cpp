@@ -0,0 +1,176 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "send_string.h"
+#include "unicode.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class UnicodeAsync : public TestFixture {
+   public:
+    ~UnicodeAsync() {
+        send_string_async_cancel();
+    }
+};
+
+#define EXPECT_TAP(driver, key)         \
+    do {                                \
+        EXPECT_REPORT(driver, (key));   \
+        EXPECT_EMPTY_REPORT(driver);    \
+    } while (0)
+
+TEST_F(UnicodeAsync, linux_string) {
+    TestDriver driver;
+    InSequence s;
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+
+    EXPECT_TRUE(send_unicode_string_async("é"));
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT, KC_U));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    idle_for(5);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Nothing is typed during UNICODE_TYPE_DELAY, while the matrix keeps being scanned. */
+    EXPECT_NO_REPORT(driver);
+    idle_for(9);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TAP(driver, KC_0);
+    EXPECT_TAP(driver, KC_0);
+    EXPECT_TAP(driver, KC_E);
+    EXPECT_TAP(driver, KC_9);
+    EXPECT_TAP(driver, KC_SPACE);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(send_string_async_is_busy());
+}
+
+TEST_F(UnicodeAsync, windows_key_toggles_num_lock) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_uc = KeymapKey(0, 0, 0, UC(0x2603));
+    set_keymap({key_uc});
+    set_unicode_input_mode(UNICODE_MODE_WINDOWS);
+
+    EXPECT_TAP(driver, KC_NUM_LOCK);
+    EXPECT_REPORT(driver, (KC_LALT));
+    EXPECT_REPORT(driver, (KC_LALT, KC_KP_PLUS));
+    EXPECT_REPORT(driver, (KC_LALT));
+    EXPECT_REPORT(driver, (KC_LALT, KC_KP_2));
+    EXPECT_REPORT(driver, (KC_LALT));
+    EXPECT_REPORT(driver, (KC_LALT, KC_KP_6));
+    EXPECT_REPORT(driver, (KC_LALT));
+    EXPECT_REPORT(driver, (KC_LALT, KC_KP_0));
+    EXPECT_REPORT(driver, (KC_LALT));
+    EXPECT_REPORT(driver, (KC_LALT, KC_KP_3));
+    EXPECT_REPORT(driver, (KC_LALT));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_TAP(driver, KC_NUM_LOCK);
+    tap_key(key_uc);
+    idle_for(40);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, held_modifiers_are_released_and_restored) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_shift = KeymapKey(0, 0, 0, KC_LSFT);
+    auto       key_uc    = KeymapKey(0, 1, 0, UC(0x00C9));
+    auto       key_a     = KeymapKey(0, 2, 0, KC_A);
+    set_keymap({key_shift, key_uc, key_a});
+    set_unicode_input_mode(UNICODE_MODE_WINCOMPOSE);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_TAP(driver, KC_RALT);
+    EXPECT_TAP(driver, KC_U);
+    EXPECT_TAP(driver, KC_0);
+    EXPECT_TAP(driver, KC_0);
+    EXPECT_TAP(driver, KC_C);
+    EXPECT_TAP(driver, KC_9);
+    EXPECT_TAP(driver, KC_ENTER);
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_uc.press();
+    idle_for(40);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Shift still applies to the keys pressed after the code point. */
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_uc.release();
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, modifier_released_while_typing_stays_released) {
+    TestDriver driver;
+    auto       key_shift = KeymapKey(0, 0, 0, KC_LSFT);
+    auto       key_uc    = KeymapKey(0, 1, 0, UC(0x00C9));
+    auto       key_a     = KeymapKey(0, 2, 0, KC_A);
+    set_keymap({key_shift, key_uc, key_a});
+    set_unicode_input_mode(UNICODE_MODE_WINCOMPOSE);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_shift.press();
+    run_one_scan_loop();
+    key_uc.press();
+    idle_for(5);
+    EXPECT_TRUE(send_string_async_is_busy());
+
+    /* Shift is let go of while the code point is still being typed. */
+    key_shift.release();
+    idle_for(40);
+    EXPECT_FALSE(send_string_async_is_busy());
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(get_mods(), 0);
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key_uc.release();
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, typed_in_order_with_other_strings) {
+    TestDriver driver;
+    InSequence s;
+    set_unicode_input_mode(UNICODE_MODE_MACOS);
+
+    EXPECT_TRUE(send_string_async("a", 0, NULL, NULL));
+    EXPECT_TRUE(send_unicode_string_async("\U0001F600"));
+    EXPECT_TRUE(send_string_async("b", 0, NULL, NULL));
+
+    EXPECT_TAP(driver, KC_A);
+    EXPECT_REPORT(driver, (KC_LALT));
+    for (uint16_t key : {KC_D, KC_8, KC_3, KC_D, KC_D, KC_E, KC_0, KC_0}) {
+        EXPECT_REPORT(driver, (KC_LALT, key));
+        EXPECT_REPORT(driver, (KC_LALT));
+    }
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_TAP(driver, KC_B);
+    idle_for(40);
+    VERIFY_AND_CLEAR(driver);
+}
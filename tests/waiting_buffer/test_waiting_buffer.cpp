@@ -0,0 +1,85 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "task_profiler.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class WaitingBuffer : public TestFixture {
+   public:
+    WaitingBuffer() {
+        task_profiler_reset();
+    }
+
+    /* Types the key `count` times while the tapping key is still undecided. */
+    void roll(KeymapKey &key, int count) {
+        for (int i = 0; i < count; i++) {
+            key.press();
+            run_one_scan_loop();
+            key.release();
+            run_one_scan_loop();
+        }
+    }
+};
+
+TEST_F(WaitingBuffer, fast_roll_is_not_dropped) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key  = KeymapKey(0, 0, 0, SFT_T(KC_P));
+    auto       regular_key  = KeymapKey(0, 1, 0, KC_A);
+    uint16_t   overflows_at = waiting_buffer_overflow_count();
+    set_keymap({mod_tap_key, regular_key});
+
+    /* The rolled keys and the release of the mod-tap key all wait in the
+     * buffer, one slot is left. */
+    EXPECT_NO_REPORT(driver);
+    idle_for(1);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    roll(regular_key, WAITING_BUFFER_SIZE / 2 - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    for (int i = 0; i < WAITING_BUFFER_SIZE / 2 - 1; i++) {
+        EXPECT_REPORT(driver, (KC_P, KC_A));
+        EXPECT_REPORT(driver, (KC_P));
+    }
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(waiting_buffer_overflow_count(), overflows_at);
+    EXPECT_EQ(task_profiler_get_event_count(TASK_PROFILER_EVENT_WAITING_BUFFER_OVERFLOW), 0);
+}
+
+TEST_F(WaitingBuffer, overflow_is_counted) {
+    TestDriver driver;
+    auto       mod_tap_key  = KeymapKey(0, 0, 0, SFT_T(KC_P));
+    auto       regular_key  = KeymapKey(0, 1, 0, KC_A);
+    uint16_t   overflows_at = waiting_buffer_overflow_count();
+    set_keymap({mod_tap_key, regular_key});
+
+    /* One event more than fits drops the buffer and clears all state. */
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AnyNumber());
+    idle_for(1);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    roll(regular_key, WAITING_BUFFER_SIZE / 2);
+    regular_key.press();
+    run_one_scan_loop();
+    regular_key.release();
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(waiting_buffer_overflow_count(), overflows_at + 1);
+    EXPECT_EQ(task_profiler_get_event_count(TASK_PROFILER_EVENT_WAITING_BUFFER_OVERFLOW), 1);
+}
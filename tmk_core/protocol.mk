@@ -1,6 +1,7 @@
 TMK_COMMON_SRC +=	\
 	$(PROTOCOL_DIR)/host.c \
 	$(PROTOCOL_DIR)/report.c \
+	$(PROTOCOL_DIR)/report_queue.c \
 	$(PROTOCOL_DIR)/usb_device_state.c \
 	$(PROTOCOL_DIR)/usb_util.c \
 
@@ -43,6 +43,7 @@
 #include "usb_device_state.h"
 #include "usb_descriptor.h"
 #include "usb_driver.h"
+#include "report_queue.h"
 
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
@@ -129,14 +130,97 @@ static const USBDescriptor *usb_get_descriptor_cb(USBDriver *usbp, uint8_t dtype
         return &desc;
 }
 
+/* Reports waiting for their IN endpoint, one queue per HID report endpoint */
+enum {
+#ifndef KEYBOARD_SHARED_EP
+    KEYBOARD_REPORT_QUEUE,
+#endif
+#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+    MOUSE_REPORT_QUEUE,
+#endif
+#ifdef SHARED_EP_ENABLE
+    SHARED_REPORT_QUEUE,
+#endif
+#if defined(JOYSTICK_ENABLE) && !defined(JOYSTICK_SHARED_EP)
+    JOYSTICK_REPORT_QUEUE,
+#endif
+#if defined(DIGITIZER_ENABLE) && !defined(DIGITIZER_SHARED_EP)
+    DIGITIZER_REPORT_QUEUE,
+#endif
+    NUM_REPORT_QUEUES
+};
+
+static const usbep_t report_queue_endpoints[NUM_REPORT_QUEUES] = {
+#ifndef KEYBOARD_SHARED_EP
+    [KEYBOARD_REPORT_QUEUE] = KEYBOARD_IN_EPNUM,
+#endif
+#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+    [MOUSE_REPORT_QUEUE] = MOUSE_IN_EPNUM,
+#endif
+#ifdef SHARED_EP_ENABLE
+    [SHARED_REPORT_QUEUE] = SHARED_IN_EPNUM,
+#endif
+#if defined(JOYSTICK_ENABLE) && !defined(JOYSTICK_SHARED_EP)
+    [JOYSTICK_REPORT_QUEUE] = JOYSTICK_IN_EPNUM,
+#endif
+#if defined(DIGITIZER_ENABLE) && !defined(DIGITIZER_SHARED_EP)
+    [DIGITIZER_REPORT_QUEUE] = DIGITIZER_IN_EPNUM,
+#endif
+};
+
+static report_queue_t report_queues[NUM_REPORT_QUEUES];
+
+static report_queue_t *get_report_queue(uint8_t endpoint) {
+    for (int i = 0; i < NUM_REPORT_QUEUES; i++) {
+        if (report_queues[i].endpoint == endpoint) {
+            return &report_queues[i];
+        }
+    }
+    return NULL;
+}
+
+/* Starts a report transfer if the endpoint is free (called in locked state) */
+static bool report_transmit_i(uint8_t endpoint, const void *report, uint8_t size) {
+    if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE || usbGetTransmitStatusI(&USB_DRIVER, endpoint)) {
+        return false;
+    }
+    usbStartTransmitI(&USB_DRIVER, endpoint, (const uint8_t *)report, size);
+    return true;
+}
+
+/*
+ * Waits up to 10 ms for the transfer in progress on a full queue to complete
+ * (called in locked state, needs USB_USE_WAIT == TRUE in halconf.h)
+ */
+static bool report_wait_s(uint8_t endpoint) {
+    return osalThreadSuspendTimeoutS(&(&USB_DRIVER)->epc[endpoint]->in_state->thread, TIME_MS2I(10)) == MSG_OK;
+}
+
 /*
- * USB notification callback that does nothing.  Needed to work around bugs in
- * some USB LLDs that fail to resume the waiting thread when the notification
- * callback pointer is NULL.
+ * IN notification callback of the report endpoints, starts the next queued
+ * report (called from ISR, unlocked state)
  */
-static void dummy_usb_cb(USBDriver *usbp, usbep_t ep) {
+static void report_transmitted_cb(USBDriver *usbp, usbep_t ep) {
     (void)usbp;
-    (void)ep;
+    report_queue_t *queue = get_report_queue(ep);
+    if (queue == NULL) {
+        return;
+    }
+
+    osalSysLockFromISR();
+    report_queue_transmitted(queue);
+    osalSysUnlockFromISR();
+}
+
+/* Forgets the queued reports, the endpoints lose them on reset (called in locked state) */
+static void clear_report_queues_i(void) {
+    for (int i = 0; i < NUM_REPORT_QUEUES; i++) {
+        report_queue_clear(&report_queues[i]);
+    }
+}
+
+const report_queue_t *usb_get_report_queue(uint8_t endpoint) {
+    return get_report_queue(endpoint);
 }
 
 #ifndef KEYBOARD_SHARED_EP
@@ -146,7 +230,7 @@ static USBInEndpointState kbd_ep_state;
 static const USBEndpointConfig kbd_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_transmitted_cb,  /* IN notification callback */
     NULL,                   /* OUT notification callback */
     KEYBOARD_EPSIZE,        /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -164,7 +248,7 @@ static USBInEndpointState mouse_ep_state;
 static const USBEndpointConfig mouse_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_transmitted_cb,  /* IN notification callback */
     NULL,                   /* OUT notification callback */
     MOUSE_EPSIZE,           /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -182,7 +266,7 @@ static USBInEndpointState shared_ep_state;
 static const USBEndpointConfig shared_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_transmitted_cb,  /* IN notification callback */
     NULL,                   /* OUT notification callback */
     SHARED_EPSIZE,          /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -200,7 +284,7 @@ static USBInEndpointState joystick_ep_state;
 static const USBEndpointConfig joystick_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_transmitted_cb,  /* IN notification callback */
     NULL,                   /* OUT notification callback */
     JOYSTICK_EPSIZE,        /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -218,7 +302,7 @@ static USBInEndpointState digitizer_ep_state;
 static const USBEndpointConfig digitizer_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_transmitted_cb,  /* IN notification callback */
     NULL,                   /* OUT notification callback */
     DIGITIZER_EPSIZE,       /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -506,6 +590,7 @@ static void usb_event_cb(USBDriver *usbp, usbevent_t event) {
 
         case USB_EVENT_CONFIGURED:
             osalSysLockFromISR();
+            clear_report_queues_i();
             /* Enable the endpoints specified into the configuration. */
 #ifndef KEYBOARD_SHARED_EP
             usbInitEndpointI(usbp, KEYBOARD_IN_EPNUM, &kbd_ep_config);
@@ -546,6 +631,14 @@ static void usb_event_cb(USBDriver *usbp, usbevent_t event) {
             /* Falls into.*/
         case USB_EVENT_RESET:
             usb_event_queue_enqueue(event);
+            if (event != USB_EVENT_SUSPEND) {
+                /* The endpoints were reset or disabled, so no transfer reads
+                 * from the queues anymore. On suspend the transfer in progress
+                 * is only paused, and completes once the host resumes. */
+                osalSysLockFromISR();
+                clear_report_queues_i();
+                osalSysUnlockFromISR();
+            }
             for (int i = 0; i < NUM_USB_DRIVERS; i++) {
                 chSysLockFromISR();
                 /* Disconnection event on suspend.*/
@@ -766,6 +859,10 @@ static const USBConfig usbcfg = {
  * Initialize the USB driver
  */
 void init_usb_driver(USBDriver *usbp) {
+    for (int i = 0; i < NUM_REPORT_QUEUES; i++) {
+        report_queue_init(&report_queues[i], report_queue_endpoints[i], report_transmit_i, report_wait_s);
+    }
+
     for (int i = 0; i < NUM_USB_DRIVERS; i++) {
 #ifdef USB_ENDPOINTS_ARE_REORDERABLE
         QMKUSBDriver *driver                       = &drivers.array[i].driver;
@@ -842,8 +939,12 @@ static void keyboard_idle_timer_cb(struct ch_virtual_timer *timer, void *arg) {
     if (keyboard_idle && keyboard_protocol) {
 #endif /* NKRO_ENABLE */
         /* TODO: are we sure we want the KBD_ENDPOINT? */
-        if (!usbGetTransmitStatusI(usbp, KEYBOARD_IN_EPNUM)) {
-            usbStartTransmitI(usbp, KEYBOARD_IN_EPNUM, (uint8_t *)&keyboard_report_sent, KEYBOARD_EPSIZE);
+        /* Goes through the queue so that it cannot overtake queued reports, or
+         * be overwritten while in transfer. Queued reports renew the idle
+         * period anyway, and an empty queue never waits in the ISR. */
+        report_queue_t *queue = get_report_queue(KEYBOARD_IN_EPNUM);
+        if (queue != NULL && report_queue_depth(queue) == 0) {
+            report_queue_submit(queue, &keyboard_report_sent, KEYBOARD_REPORT_SIZE, REPORT_QUEUE_KIND_OTHER);
         }
         /* rearm the timer */
         chVTSetI(&keyboard_idle_timer, 4 * TIME_MS2I(keyboard_idle), keyboard_idle_timer_cb, (void *)usbp);
@@ -859,24 +960,21 @@ uint8_t keyboard_leds(void) {
     return keyboard_led_state;
 }
 
-void send_report(uint8_t endpoint, void *report, size_t size) {
+/* Queues a report for its IN endpoint, the queue is drained from
+ * report_transmitted_cb(). Only waits for the endpoint when the queue is full. */
+void send_report(uint8_t endpoint, void *report, size_t size, report_queue_kind_t kind) {
+    report_queue_t *queue = get_report_queue(endpoint);
+    if (queue == NULL) {
+        return;
+    }
+
     osalSysLock();
     if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE) {
         osalSysUnlock();
         return;
     }
 
-    if (usbGetTransmitStatusI(&USB_DRIVER, endpoint)) {
-        /* Need to either suspend, or loop and call unlock/lock during
-         * every iteration - otherwise the system will remain locked,
-         * no interrupts served, so USB not going through as well.
-         * Note: for suspend, need USB_USE_WAIT == TRUE in halconf.h */
-        if (osalThreadSuspendTimeoutS(&(&USB_DRIVER)->epc[endpoint]->in_state->thread, TIME_MS2I(10)) == MSG_TIMEOUT) {
-            osalSysUnlock();
-            return;
-        }
-    }
-    usbStartTransmitI(&USB_DRIVER, endpoint, report, size);
+    report_queue_submit(queue, report, size, kind);
     osalSysUnlock();
 }
 
@@ -888,7 +986,7 @@ void send_keyboard(report_keyboard_t *report) {
 
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (!keyboard_protocol) {
-        send_report(ep, &report->mods, 8);
+        send_report(ep, &report->mods, 8, REPORT_QUEUE_KIND_OTHER);
     } else {
 #ifdef NKRO_ENABLE
         if (keymap_config.nkro) {
@@ -897,7 +995,7 @@ void send_keyboard(report_keyboard_t *report) {
         }
 #endif
 
-        send_report(ep, report, size);
+        send_report(ep, report, size, REPORT_QUEUE_KIND_OTHER);
     }
 
     keyboard_report_sent = *report;
@@ -910,7 +1008,7 @@ void send_keyboard(report_keyboard_t *report) {
 
 void send_mouse(report_mouse_t *report) {
 #ifdef MOUSE_ENABLE
-    send_report(MOUSE_IN_EPNUM, report, sizeof(report_mouse_t));
+    send_report(MOUSE_IN_EPNUM, report, sizeof(report_mouse_t), REPORT_QUEUE_KIND_MOUSE);
     mouse_report_sent = *report;
 #endif
 }
@@ -922,25 +1020,25 @@ void send_mouse(report_mouse_t *report) {
 
 void send_extra(report_extra_t *report) {
 #ifdef EXTRAKEY_ENABLE
-    send_report(SHARED_IN_EPNUM, report, sizeof(report_extra_t));
+    send_report(SHARED_IN_EPNUM, report, sizeof(report_extra_t), REPORT_QUEUE_KIND_OTHER);
 #endif
 }
 
 void send_programmable_button(report_programmable_button_t *report) {
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-    send_report(SHARED_IN_EPNUM, report, sizeof(report_programmable_button_t));
+    send_report(SHARED_IN_EPNUM, report, sizeof(report_programmable_button_t), REPORT_QUEUE_KIND_OTHER);
 #endif
 }
 
 void send_joystick(report_joystick_t *report) {
 #ifdef JOYSTICK_ENABLE
-    send_report(JOYSTICK_IN_EPNUM, report, sizeof(report_joystick_t));
+    send_report(JOYSTICK_IN_EPNUM, report, sizeof(report_joystick_t), REPORT_QUEUE_KIND_OTHER);
 #endif
 }
 
 void send_digitizer(report_digitizer_t *report) {
 #ifdef DIGITIZER_ENABLE
-    send_report(DIGITIZER_IN_EPNUM, report, sizeof(report_digitizer_t));
+    send_report(DIGITIZER_IN_EPNUM, report, sizeof(report_digitizer_t), REPORT_QUEUE_KIND_OTHER);
 #endif
 }
 
@@ -20,6 +20,8 @@
 #include <ch.h>
 #include <hal.h>
 
+#include "report_queue.h"
+
 /* -------------------------
  * General USB driver header
  * -------------------------
@@ -47,6 +49,14 @@ void usb_event_queue_init(void);
 /* Task to dequeue and execute any handlers for the USB events on the main thread */
 void usb_event_queue_task(void);
 
+/* ------------------
+ * HID report queues
+ * ------------------
+ */
+
+/* Report queue of a HID IN endpoint, for its depth and drop statistics (NULL for other endpoints) */
+const report_queue_t *usb_get_report_queue(uint8_t endpoint);
+
 /* --------------
  * Console header
  * --------------
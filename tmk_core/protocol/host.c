@@ -16,11 +16,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 #include "keyboard.h"
 #include "keycode.h"
 #include "host.h"
 #include "util.h"
 #include "debug.h"
+#include "task_profiler.h"
 
 #ifdef DIGITIZER_ENABLE
 #    include "digitizer.h"
@@ -43,6 +45,14 @@ extern keymap_config_t keymap_config;
 static host_driver_t *driver;
 static uint16_t       last_system_usage   = 0;
 static uint16_t       last_consumer_usage = 0;
+static uint16_t       suppressed_reports[HOST_REPORT_COUNT];
+
+static void count_suppressed_report(host_report_t report, task_profiler_event_t event) {
+    if (suppressed_reports[report] < UINT16_MAX) {
+        suppressed_reports[report]++;
+    }
+    task_profiler_count_event(event);
+}
 
 void host_set_driver(host_driver_t *d) {
     driver = d;
@@ -127,7 +137,10 @@ void host_mouse_send(report_mouse_t *report) {
 }
 
 void host_system_send(uint16_t usage) {
-    if (usage == last_system_usage) return;
+    if (usage == last_system_usage) {
+        count_suppressed_report(HOST_REPORT_SYSTEM, TASK_PROFILER_EVENT_SYSTEM_REPORT_SUPPRESSED);
+        return;
+    }
     last_system_usage = usage;
 
     if (!driver) return;
@@ -140,7 +153,10 @@ void host_system_send(uint16_t usage) {
 }
 
 void host_consumer_send(uint16_t usage) {
-    if (usage == last_consumer_usage) return;
+    if (usage == last_consumer_usage) {
+        count_suppressed_report(HOST_REPORT_CONSUMER, TASK_PROFILER_EVENT_CONSUMER_REPORT_SUPPRESSED);
+        return;
+    }
     last_consumer_usage = usage;
 
 #ifdef BLUETOOTH_ENABLE
@@ -253,3 +269,14 @@ uint16_t host_last_system_usage(void) {
 uint16_t host_last_consumer_usage(void) {
     return last_consumer_usage;
 }
+
+uint16_t host_suppressed_report_count(host_report_t report) {
+    if (report >= HOST_REPORT_COUNT) {
+        return 0;
+    }
+    return suppressed_reports[report];
+}
+
+void host_reset_suppressed_report_count(void) {
+    memset(suppressed_reports, 0, sizeof(suppressed_reports));
+}
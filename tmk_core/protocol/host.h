@@ -33,6 +33,12 @@ extern "C" {
 extern uint8_t keyboard_idle;
 extern uint8_t keyboard_protocol;
 
+typedef enum host_report_t {
+    HOST_REPORT_SYSTEM,
+    HOST_REPORT_CONSUMER,
+    HOST_REPORT_COUNT,
+} host_report_t;
+
 /* host driver */
 void           host_set_driver(host_driver_t *driver);
 host_driver_t *host_get_driver(void);
@@ -49,6 +55,10 @@ void    host_programmable_button_send(uint32_t data);
 uint16_t host_last_system_usage(void);
 uint16_t host_last_consumer_usage(void);
 
+/* reports dropped because they would not change anything on the host */
+uint16_t host_suppressed_report_count(host_report_t report);
+void     host_reset_suppressed_report_count(void);
+
 #ifdef __cplusplus
 }
 #endif
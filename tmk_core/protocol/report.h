@@ -135,6 +135,8 @@ enum desktop_usages {
 #        define KEYBOARD_REPORT_BITS (NKRO_EPSIZE - 1)
 #        undef NKRO_SHARED_EP
 #        undef MOUSE_SHARED_EP
+#    elif defined(PROTOCOL_TEST)
+#        define KEYBOARD_REPORT_BITS 30
 #    else
 #        error "NKRO not supported with this protocol"
 #    endif
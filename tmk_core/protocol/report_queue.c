@@ -0,0 +1,165 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "report_queue.h"
+#include "task_profiler.h"
+
+static report_queue_entry_t *queue_entry(report_queue_t *queue, uint8_t index) {
+    return &queue->entries[(queue->head + index) % REPORT_QUEUE_LENGTH];
+}
+
+static bool add_motion(int16_t *sum, int16_t delta, int16_t min, int16_t max) {
+    int32_t result = (int32_t)*sum + delta;
+    if (result < min || result > max) {
+        return false;
+    }
+    *sum = result;
+    return true;
+}
+
+/* Adds the motion of `report` to the queued `queued` report, as long as the
+ * buttons are the same and none of the axes overflow. */
+static bool merge_mouse_report(report_mouse_t *queued, const report_mouse_t *report) {
+    if (queued->buttons != report->buttons) {
+        return false;
+    }
+#ifdef MOUSE_SHARED_EP
+    if (queued->report_id != report->report_id) {
+        return false;
+    }
+#endif
+#ifdef MOUSE_EXTENDED_REPORT
+    const int16_t xy_min = INT16_MIN, xy_max = INT16_MAX;
+#else
+    const int16_t xy_min = INT8_MIN, xy_max = INT8_MAX;
+#endif
+
+    int16_t x = queued->x, y = queued->y, v = queued->v, h = queued->h;
+    if (!add_motion(&x, report->x, xy_min, xy_max) || !add_motion(&y, report->y, xy_min, xy_max) || !add_motion(&v, report->v, INT8_MIN, INT8_MAX) || !add_motion(&h, report->h, INT8_MIN, INT8_MAX)) {
+        return false;
+    }
+#ifdef MOUSE_EXTENDED_REPORT
+    int16_t boot_x = queued->boot_x, boot_y = queued->boot_y;
+    if (!add_motion(&boot_x, report->boot_x, INT8_MIN, INT8_MAX) || !add_motion(&boot_y, report->boot_y, INT8_MIN, INT8_MAX)) {
+        return false;
+    }
+    queued->boot_x = boot_x;
+    queued->boot_y = boot_y;
+#endif
+    queued->x = x;
+    queued->y = y;
+    queued->v = v;
+    queued->h = h;
+    return true;
+}
+
+static bool coalesce_report(report_queue_t *queue, const void *report, uint8_t size, report_queue_kind_t kind) {
+    if (kind != REPORT_QUEUE_KIND_MOUSE || size != sizeof(report_mouse_t)) {
+        return false;
+    }
+    if (queue->depth == 0 || (queue->depth == 1 && queue->in_flight)) {
+        return false;
+    }
+
+    /* Only the newest queued report can be merged, the order of reports of
+     * different kinds sharing an endpoint must not change. */
+    report_queue_entry_t *tail = queue_entry(queue, queue->depth - 1);
+    if (tail->kind != kind || tail->size != size) {
+        return false;
+    }
+    return merge_mouse_report(&tail->report.mouse, report);
+}
+
+static void start_transfer(report_queue_t *queue) {
+    if (queue->in_flight || queue->depth == 0) {
+        return;
+    }
+
+    report_queue_entry_t *entry = queue_entry(queue, 0);
+    queue->in_flight            = queue->transmit(queue->endpoint, entry->report.raw, entry->size);
+}
+
+void report_queue_init(report_queue_t *queue, uint8_t endpoint, report_queue_transmit_t transmit, report_queue_wait_t wait) {
+    memset(queue, 0, sizeof(report_queue_t));
+    queue->endpoint = endpoint;
+    queue->transmit = transmit;
+    queue->wait     = wait;
+}
+
+void report_queue_clear(report_queue_t *queue) {
+    queue->head      = 0;
+    queue->depth     = 0;
+    queue->in_flight = false;
+}
+
+bool report_queue_submit(report_queue_t *queue, const void *report, uint8_t size, report_queue_kind_t kind) {
+    if (size > sizeof(report_queue_buffer_t)) {
+        return false;
+    }
+
+    if (coalesce_report(queue, report, size, kind)) {
+        if (queue->coalesced < UINT16_MAX) {
+            queue->coalesced++;
+        }
+        task_profiler_count_event(TASK_PROFILER_EVENT_REPORT_QUEUE_COALESCED);
+        start_transfer(queue);
+        return true;
+    }
+
+    /* Like a blocking send, wait for the host to collect a queued report
+     * rather than give up one. Each completed transfer frees an entry. */
+    while (queue->depth >= REPORT_QUEUE_LENGTH) {
+        start_transfer(queue);
+        if (!queue->in_flight || queue->wait == NULL || !queue->wait(queue->endpoint)) {
+            if (queue->dropped < UINT16_MAX) {
+                queue->dropped++;
+            }
+            task_profiler_count_event(TASK_PROFILER_EVENT_REPORT_QUEUE_DROPPED);
+            return false;
+        }
+    }
+
+    report_queue_entry_t *entry = queue_entry(queue, queue->depth);
+    memcpy(entry->report.raw, report, size);
+    entry->size = size;
+    entry->kind = kind;
+    queue->depth++;
+    if (queue->depth > queue->max_depth) {
+        queue->max_depth = queue->depth;
+    }
+
+    start_transfer(queue);
+    return true;
+}
+
+void report_queue_transmitted(report_queue_t *queue) {
+    if (queue->in_flight) {
+        queue->head      = (queue->head + 1) % REPORT_QUEUE_LENGTH;
+        queue->depth--;
+        queue->in_flight = false;
+    }
+    start_transfer(queue);
+}
+
+uint8_t report_queue_depth(const report_queue_t *queue) {
+    return queue->depth;
+}
+
+uint8_t report_queue_max_depth(const report_queue_t *queue) {
+    return queue->max_depth;
+}
+
+uint16_t report_queue_coalesced_count(const report_queue_t *queue) {
+    return queue->coalesced;
+}
+
+uint16_t report_queue_dropped_count(const report_queue_t *queue) {
+    return queue->dropped;
+}
+
+void report_queue_reset_stats(report_queue_t *queue) {
+    queue->max_depth = queue->depth;
+    queue->coalesced = 0;
+    queue->dropped   = 0;
+}
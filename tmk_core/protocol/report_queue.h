@@ -0,0 +1,124 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "report.h"
+
+#ifndef REPORT_QUEUE_LENGTH
+#    define REPORT_QUEUE_LENGTH 4
+#endif
+
+/**
+ * @brief How a queued report may be merged with a newer one of the same kind.
+ */
+typedef enum report_queue_kind_t {
+    /** Never merged, every report is sent. */
+    REPORT_QUEUE_KIND_OTHER,
+    /** Motion of a newer mouse report is added to a queued older one with the same buttons. */
+    REPORT_QUEUE_KIND_MOUSE,
+} report_queue_kind_t;
+
+typedef union {
+    uint8_t                      raw[1];
+    report_keyboard_t            keyboard;
+    report_mouse_t               mouse;
+    report_extra_t               extra;
+    report_programmable_button_t programmable_button;
+#ifdef DIGITIZER_ENABLE
+    report_digitizer_t digitizer;
+#endif
+#ifdef JOYSTICK_ENABLE
+    report_joystick_t joystick;
+#endif
+} report_queue_buffer_t;
+
+typedef struct {
+    report_queue_buffer_t report;
+    uint8_t               size;
+    uint8_t               kind;
+} report_queue_entry_t;
+
+/**
+ * @brief Starts the transfer of one report on `endpoint`.
+ *
+ * Returns false when the endpoint is busy, the report then stays queued until
+ * `report_queue_transmitted()` is called for the transfer that is in progress.
+ */
+typedef bool (*report_queue_transmit_t)(uint8_t endpoint, const void *report, uint8_t size);
+
+/**
+ * @brief Waits for the transfer in progress on `endpoint` to complete.
+ *
+ * Returns false if it did not complete in time. `report_queue_transmitted()`
+ * must have been called for the transfer when it returns true.
+ */
+typedef bool (*report_queue_wait_t)(uint8_t endpoint);
+
+typedef struct {
+    report_queue_entry_t    entries[REPORT_QUEUE_LENGTH];
+    report_queue_transmit_t transmit;
+    report_queue_wait_t     wait;
+    uint8_t                 endpoint;
+    uint8_t                 head;
+    uint8_t                 depth;
+    uint8_t                 max_depth;
+    bool                    in_flight;
+    uint16_t                coalesced;
+    uint16_t                dropped;
+} report_queue_t;
+
+/**
+ * @brief Sets up an empty queue for the given endpoint.
+ */
+void report_queue_init(report_queue_t *queue, uint8_t endpoint, report_queue_transmit_t transmit, report_queue_wait_t wait);
+
+/**
+ * @brief Forgets all queued reports, e.g. after the endpoint has been reset.
+ *
+ * The statistics are kept.
+ */
+void report_queue_clear(report_queue_t *queue);
+
+/**
+ * @brief Queues a copy of `report` and starts its transfer if the endpoint is idle.
+ *
+ * Mouse motion is merged into a queued report where possible. Otherwise, when
+ * the queue is full, this waits for the transfer in progress to complete.
+ * Returns false if that timed out and the report had to be dropped.
+ */
+bool report_queue_submit(report_queue_t *queue, const void *report, uint8_t size, report_queue_kind_t kind);
+
+/**
+ * @brief Completes the transfer in progress and starts the next queued one.
+ *
+ * Meant to be called from the endpoint completion callback.
+ */
+void report_queue_transmitted(report_queue_t *queue);
+
+/**
+ * @brief Returns the number of queued reports, including the one in transfer.
+ */
+uint8_t report_queue_depth(const report_queue_t *queue);
+
+/**
+ * @brief Returns the highest queue depth seen since the last reset of the statistics.
+ */
+uint8_t report_queue_max_depth(const report_queue_t *queue);
+
+/**
+ * @brief Returns the number of reports merged into an already queued one.
+ */
+uint16_t report_queue_coalesced_count(const report_queue_t *queue);
+
+/**
+ * @brief Returns the number of reports dropped because the queue stayed full.
+ */
+uint16_t report_queue_dropped_count(const report_queue_t *queue);
+
+/**
+ * @brief Resets the maximum depth, coalesced and dropped counters.
+ */
+void report_queue_reset_stats(report_queue_t *queue);